@@ -1,20 +1,45 @@
 #pragma once
 
 #include <bit>
+#include <span>
 #include <utility>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <atomic>
+#include <vector>
 #include <variant>
 #include <fstream>
 #include <optional>
+#include <algorithm>
 #include <iostream>
 #include <filesystem>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif//WIN32
+
 #include "models/str.hpp"
 
+#include "traits/rule_of_5.hpp"
+
+#include "utils/simd.hpp"
+
+#include "./trace.hpp"
+
 namespace fs
 {
+	// unique per process
+	inline /*Ი︵𐑼*/ auto uid() -> uint32_t
+	{
+		static std::atomic<uint32_t> next {0};
+
+		return next++;
+	}
+
 	template
 	<
 		model::text A,
@@ -24,6 +49,57 @@ namespace fs
 	{
 		A path;
 		B data;
+		// see span::file
+		uint32_t id {fs::uid()};
+		// line starts, built on demand
+		std::vector<uint32_t> rows {};
+
+		// (line, column), both 1-based
+		inline /*Ი︵𐑼*/ auto locate(const uint32_t offset) -> std::pair<size_t, size_t>
+		{
+			const auto* head {this->data.c_str()};
+
+			if (this->rows.empty())
+			{
+				this->rows.emplace_back(0);
+
+				for (auto ptr {head}; *(ptr = utils::find_any(ptr, '\n', '\n')); ++ptr)
+				{
+					this->rows.emplace_back(ptr - head + 1);
+				}
+			}
+
+			const auto row
+			{
+				std::upper_bound
+				(
+					this->rows.begin(),
+					this->rows.end(),
+					offset
+				)
+				- 1
+			};
+
+			return
+			{
+				row - this->rows.begin() + 1,
+				utils::points(head + *row, head + offset) + 1
+			};
+		}
+
+		// FNV-1a over every code unit
+		inline constexpr auto hash() const -> uint64_t
+		{
+			uint64_t out {0xCBF29CE484222325 ^ sizeof(*this->data.c_str())};
+
+			const auto* ptr {reinterpret_cast<const unsigned char*>(this->data.c_str())};
+
+			for (size_t i {0}; i < this->data.size() * sizeof(*this->data.c_str()); ++i)
+			{
+				out = (out ^ ptr[i]) * 0x100000001B3;
+			}
+			return out;
+		}
 
 		inline constexpr auto lines() -> auto
 		{
@@ -58,10 +134,6 @@ namespace fs
 
 		if (std::ifstream ifs {sys, std::ios::binary})
 		{
-			#ifndef NDEBUG //-----------------------|
-			std::cout << (u8"[✓] %s" | path) << '\n';
-			#endif //-------------------------------|
-
 			enum encoding : uint8_t
 			{
 				UTF8_STD = (0 << 4) | 0,
@@ -166,6 +238,8 @@ namespace fs
 			// to the BOM
 			ifs.seekg(off, std::ios::beg);
 
+			trace::open(true, size);
+
 			//|------------------------|
 			//| step 3. read file data |
 			//|------------------------|
@@ -386,9 +460,7 @@ namespace fs
 		}
 		else
 		{
-			#ifndef NDEBUG //-----------------------|
-			std::cout << (u8"[✗] %s" | path) << '\n';
-			#endif //-------------------------------|
+			trace::open(false, 0);
 		}
 		return std::nullopt;
 	}
@@ -413,4 +485,81 @@ namespace fs
 	{
 		return open(utf32 {path});
 	}
+
+	//|------------------------------------------|
+	//| read-only view of a whole file; mapped   |
+	//| where mmap exists, read in otherwise.    |
+	//| empty if the file cannot be opened.      |
+	//|------------------------------------------|
+
+	class map
+	{
+		const std::byte* head {nullptr};
+		size_t size {0};
+
+		#ifdef _WIN32
+		std::vector<std::byte> copy;
+		#endif//WIN32
+
+	public:
+
+		map(const std::filesystem::path& path)
+		{
+			#ifndef _WIN32
+			{
+				if (const auto fd {::open(path.c_str(), O_RDONLY)}; fd != -1)
+				{
+					struct stat info;
+
+					if (::fstat(fd, &info) == 0 && 0 < info.st_size)
+					{
+						if (auto* ptr {::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0)}; ptr != MAP_FAILED)
+						{
+							this->head = static_cast<const std::byte*>(ptr);
+							this->size = static_cast<size_t>(info.st_size);
+						}
+					}
+					::close(fd);
+				}
+			}
+			#else
+			{
+				if (std::ifstream ifs {path, std::ios::binary | std::ios::ate})
+				{
+					this->copy.resize(static_cast<size_t>(ifs.tellg()));
+
+					ifs.seekg(0, std::ios::beg);
+					ifs.read(reinterpret_cast<char*>(this->copy.data()), this->copy.size());
+
+					this->head = this->copy.data();
+					this->size = this->copy.size();
+				}
+			}
+			#endif//WIN32
+		}
+
+		~map()
+		{
+			#ifndef _WIN32
+			{
+				if (this->head)
+				{
+					::munmap(const_cast<std::byte*>(this->head), this->size);
+				}
+			}
+			#endif//WIN32
+		}
+
+		COPY_CONSTRUCTOR(map) = delete;
+		COPY_ASSIGNMENT(map) = delete;
+
+		//|-----------------|
+		//| member function |
+		//|-----------------|
+
+		inline constexpr auto data() const -> std::span<const std::byte>
+		{
+			return {this->head, this->size};
+		}
+	};
 }
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+
+//|-------------------------------------------|
+//| per-thread ring buffer of 16-byte events. |
+//|                                           |
+//| tracing is off by default; while off,     |
+//| every hook is a single relaxed load and a |
+//| branch. the newest SIZE events survive,   |
+//| and are printed by dump() on demand.      |
+//|-------------------------------------------|
+
+namespace trace
+{
+	enum class kind : uint8_t
+	{
+		OPEN, // fs::open, hit
+		MISS, // fs::open, miss
+		TOKEN,
+		ERROR,
+		ENTER, // parser rule
+		LEAVE, // parser rule
+	};
+
+	struct event
+	{
+		kind type;
+		// atom or rule
+		uint8_t code;
+		uint16_t depth;
+		// see span
+		uint32_t file;
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	static_assert(sizeof(event) == 16);
+
+	inline constexpr const size_t SIZE {1 << 12};
+
+	//|-----<state>-----|
+	inline std::atomic<bool> on {false};
+	//|-----------------|
+
+	struct ring
+	{
+		std::array<event, SIZE> data;
+		// # of events ever pushed
+		size_t head {0};
+		// # of open rules
+		uint16_t depth {0};
+	};
+
+	inline /*Ი︵𐑼*/ auto local() -> ring&
+	{
+		thread_local ring out;
+
+		return out;
+	}
+
+	// guards rules()
+	inline /*Ი︵𐑼*/ auto lock() -> std::mutex&
+	{
+		static std::mutex out;
+
+		return out;
+	}
+
+	// rule names, by id; under lock()
+	inline /*Ი︵𐑼*/ auto rules() -> std::vector<const char*>&
+	{
+		static std::vector<const char*> out;
+
+		return out;
+	}
+
+	namespace // private
+	{
+		[[gnu::cold, gnu::noinline]]
+		inline /*Ი︵𐑼*/ auto push(const kind type, const uint8_t code, const uint32_t file, const uint32_t offset, const uint32_t length)
+		{
+			auto& ring {trace::local()};
+
+			ring.depth -= type == kind::LEAVE;
+
+			ring.data[ring.head++ % SIZE] = {type, code, ring.depth, file, offset, length};
+
+			ring.depth += type == kind::ENTER;
+		}
+	}
+
+	inline /*Ი︵𐑼*/ auto enabled() -> bool
+	{
+		return trace::on.load(std::memory_order_relaxed);
+	}
+
+	inline /*Ი︵𐑼*/ auto enable(const bool value = true)
+	{
+		trace::on.store(value, std::memory_order_relaxed);
+	}
+
+	// id of a parser rule; call once per rule
+	inline /*Ი︵𐑼*/ auto rule(const char* name) -> uint8_t
+	{
+		const std::lock_guard _ {trace::lock()};
+
+		auto& list {trace::rules()};
+
+		for (size_t i {0}; i < list.size(); ++i)
+		{
+			if (std::string_view {list[i]} == name)
+			{
+				return static_cast<uint8_t>(i);
+			}
+		}
+		assert(list.size() <= UINT8_MAX);
+
+		list.emplace_back(name);
+
+		return static_cast<uint8_t>(list.size() - 1);
+	}
+
+	// token or error, by duck typing
+	inline /*Ი︵𐑼*/ auto read(const auto& arg)
+	{
+		if (!trace::enabled()) [[likely]]
+		{
+			return;
+		}
+		if constexpr (requires { arg.type; })
+		{
+			trace::push(kind::TOKEN, static_cast<uint8_t>(arg.type), arg.file, arg.offset, arg.length);
+		}
+		else
+		{
+			trace::push(kind::ERROR, 0, arg.file, arg.offset, arg.length);
+		}
+	}
+
+	inline /*Ი︵𐑼*/ auto open(const bool hit, const size_t size)
+	{
+		if (!trace::enabled()) [[likely]]
+		{
+			return;
+		}
+		trace::push(hit ? kind::OPEN : kind::MISS, 0, UINT32_MAX, 0, static_cast<uint32_t>(size));
+	}
+
+	// ENTER on construction, LEAVE on destruction
+	class scope
+	{
+		uint8_t id;
+		// ENTER recorded
+		bool open {false};
+		uint32_t file;
+		uint32_t offset;
+
+	public:
+
+		scope(const uint8_t id, const auto& pos)
+		:
+		id {id}, file {pos.file}, offset {pos.offset}
+		{
+			if (trace::enabled()) [[unlikely]]
+			{
+				trace::push(kind::ENTER, this->id, this->file, this->offset, 0);
+
+				this->open = true;
+			}
+		}
+
+		// pairs with its ENTER only, as tracing may be toggled in between
+		~scope()
+		{
+			if (this->open) [[unlikely]]
+			{
+				trace::push(kind::LEAVE, this->id, this->file, this->offset, 0);
+			}
+		}
+	};
+
+	// prints & clears this thread's events, oldest first; T names TOKEN codes
+	template
+	<
+		typename T = uint32_t
+	>
+	inline /*Ი︵𐑼*/ auto dump(std::ostream& os = std::clog)
+	{
+		// another thread's rule() may grow rules(); also, one dump at a time
+		const std::lock_guard _ {trace::lock()};
+
+		auto& ring {trace::local()};
+
+		const auto head {ring.head < SIZE ? 0 : ring.head - SIZE};
+
+		if (head != 0)
+		{
+			os << "[trace] " << head << " events dropped" << '\n';
+		}
+
+		for (auto i {head}; i < ring.head; ++i)
+		{
+			const auto& it {ring.data[i % SIZE]};
+
+			os << "[trace] " << std::string(it.depth * 2, ' ');
+
+			switch (it.type)
+			{
+				case kind::OPEN:
+				{
+					os << "open " << it.length << " bytes";
+					break;
+				}
+				case kind::MISS:
+				{
+					os << "open failed";
+					break;
+				}
+				case kind::TOKEN:
+				{
+					os << static_cast<T>(it.code) << " #" << it.file << "+" << it.offset << ":" << it.length;
+					break;
+				}
+				case kind::ERROR:
+				{
+					os << "error" << " #" << it.file << "+" << it.offset << ":" << it.length;
+					break;
+				}
+				case kind::ENTER:
+				{
+					os << "> " << trace::rules()[it.code] << " #" << it.file << "+" << it.offset;
+					break;
+				}
+				case kind::LEAVE:
+				{
+					os << "< " << trace::rules()[it.code];
+					break;
+				}
+			}
+			os << '\n';
+		}
+		ring.head = 0;
+	}
+}
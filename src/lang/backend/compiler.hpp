@@ -232,7 +232,7 @@ public:
 				std::visit(fix{visitor<void>
 				(
 					// notice: scan top-level models only for now
-					[&](auto& self, std::unique_ptr<model_decl>& decl)
+					[&](auto& self, model_decl* decl)
 					{
 						// pre-define struct as its expected for modern lang
 						local.typing[decl->name] = std::make_unique<model_t>(
@@ -267,7 +267,7 @@ public:
 				std::visit(fix{visitor<void>
 				(
 					// variant::decl
-					[&](auto& self, std::unique_ptr<var_decl>& decl)
+					[&](auto& self, var_decl* decl)
 					{
 						if (auto* type {this->resolve_type(decl->type)})
 						{
@@ -302,8 +302,13 @@ public:
 							}
 						}
 					},
-					[&](auto& self, std::unique_ptr<fun_decl>& decl)
+					[&](auto& self, fun_decl* decl)
 					{
+						// parse on demand; if it fails, it is in exe.lint & not compiled
+						if (exe.wake && !exe.wake(exe, decl))
+						{
+							return;
+						}
 						this->program += u8"%s:\n"_utf | decl->name;
 
 						//|---------------<prologue>---------------|
@@ -333,77 +338,77 @@ public:
 
 						this->program += u8"\tret"_utf /* exit */;
 					},
-					[&](auto& self, std::unique_ptr<model_decl>& decl)
+					[&](auto& self, model_decl* decl)
 					{
 
 					},
-					[&](auto& self, std::unique_ptr<trait_decl>& decl)
+					[&](auto& self, trait_decl* decl)
 					{
 
 					},
 					// variant::stmt
-					[&](auto& self, std::unique_ptr<if_stmt>& stmt)
+					[&](auto& self, if_stmt* stmt)
 					{
 
 					},
-					[&](auto& self, std::unique_ptr<for_stmt>& stmt)
+					[&](auto& self, for_stmt* stmt)
 					{
 
 					},
-					[&](auto& self, std::unique_ptr<match_stmt>& stmt)
+					[&](auto& self, match_stmt* stmt)
 					{
 
 					},
-					[&](auto& self, std::unique_ptr<while_stmt>& stmt)
+					[&](auto& self, while_stmt* stmt)
 					{
 
 					},
-					[&](auto& self, std::unique_ptr<block_stmt>& stmt)
+					[&](auto& self, block_stmt* stmt)
 					{
 
 					},
-					[&](auto& self, std::unique_ptr<break_stmt>& stmt)
+					[&](auto& self, break_stmt* stmt)
 					{
 
 					},
-					[&](auto& self, std::unique_ptr<return_stmt>& stmt)
+					[&](auto& self, return_stmt* stmt)
 					{
 
 					},
-					[&](auto& self, std::unique_ptr<iterate_stmt>& stmt)
+					[&](auto& self, iterate_stmt* stmt)
 					{
 
 					},
 					// variant::expr
-					[&](auto&& self, std::unique_ptr<prefix_expr>& expr)
+					[&](auto&& self, prefix_expr* expr)
 					{
 						this->cg(expr).release();
 					},
-					[&](auto& self, std::unique_ptr<binary_expr>& expr)
+					[&](auto& self, binary_expr* expr)
 					{
 						this->cg(expr).release();
 					},
-					[&](auto& self, std::unique_ptr<suffix_expr>& expr)
+					[&](auto& self, suffix_expr* expr)
 					{
 						this->cg(expr).release();
 					},
-					[&](auto& self, std::unique_ptr<access_expr>& expr)
+					[&](auto& self, access_expr* expr)
 					{
 						this->cg(expr).release();
 					},
-					[&](auto& self, std::unique_ptr<invoke_expr>& expr)
+					[&](auto& self, invoke_expr* expr)
 					{
 						this->cg(expr).release();
 					},
-					[&](auto& self, std::unique_ptr<literal_expr>& expr)
+					[&](auto& self, literal_expr* expr)
 					{
 						this->cg(expr).release();
 					},
-					[&](auto& self, std::unique_ptr<symbol_expr>& expr)
+					[&](auto& self, symbol_expr* expr)
 					{
 						this->cg(expr).release();
 					},
-					[&](auto& self, std::unique_ptr<group_expr>& expr)
+					[&](auto& self, group_expr* expr)
 					{
 						this->cg(expr).release();
 					}
@@ -442,11 +447,11 @@ private:
 		{
 			return std::visit([&](auto& e) { return this->cg(e); }, e);
 		}
-		if constexpr (std::is_same_v<T, std::unique_ptr<prefix_expr>>)
+		if constexpr (std::is_same_v<T, prefix_expr*>)
 		{
 			// TODO
 		}
-		if constexpr (std::is_same_v<T, std::unique_ptr<binary_expr>>)
+		if constexpr (std::is_same_v<T, binary_expr*>)
 		{
 			auto* t1 {dynamic_cast<prime_t*>(this->infer_type(e->lhs))};
 			auto* t2 {dynamic_cast<prime_t*>(this->infer_type(e->rhs))};
@@ -472,23 +477,23 @@ private:
 				}
 			}
 		}
-		if constexpr (std::is_same_v<T, std::unique_ptr<suffix_expr>>)
+		if constexpr (std::is_same_v<T, suffix_expr*>)
 		{
 			// TODO
 		}
-		if constexpr (std::is_same_v<T, std::unique_ptr<access_expr>>)
+		if constexpr (std::is_same_v<T, access_expr*>)
 		{
 			// TODO
 		}
-		if constexpr (std::is_same_v<T, std::unique_ptr<invoke_expr>>)
+		if constexpr (std::is_same_v<T, invoke_expr*>)
 		{
 			// TODO
 		}
-		if constexpr (std::is_same_v<T, std::unique_ptr<prefix_expr>>)
+		if constexpr (std::is_same_v<T, prefix_expr*>)
 		{
 			// TODO
 		}
-		if constexpr (std::is_same_v<T, std::unique_ptr<literal_expr>>)
+		if constexpr (std::is_same_v<T, literal_expr*>)
 		{
 			switch (e->type)
 			{
@@ -497,15 +502,17 @@ private:
 				case ty::I32: case ty::U32:
 				case ty::I64: case ty::U64:
 				{
-					return this->cg_load(utils::stoi(e->self));
+					// decoded by the lexer
+					return this->cg_load(static_cast<long>(std::get<uint64_t>(e->value)));
 				}
 				case ty::F32: case ty::F64:
 				{
-					return this->cg_load(utils::stof(e->self));
+					// decoded by the lexer
+					return this->cg_load(std::get<double>(e->value));
 				}
 			}
 		}
-		if constexpr (std::is_same_v<T, std::unique_ptr<symbol_expr>>)
+		if constexpr (std::is_same_v<T, symbol_expr*>)
 		{
 			auto* var {this->resolve_var(e->self)};
 
@@ -533,7 +540,7 @@ private:
 				}
 			}
 		}
-		if constexpr (std::is_same_v<T, std::unique_ptr<group_expr>>)
+		if constexpr (std::is_same_v<T, group_expr*>)
 		{
 			return this->cg(e->self);
 		}
@@ -962,7 +969,7 @@ private:
 	{
 		return std::visit(fix{visitor<typing*>
 		(
-			[&](auto& self, std::unique_ptr<literal_expr>& expr)
+			[&](auto& self, literal_expr* expr)
 			{
 				switch (expr->type)
 				{
@@ -986,23 +993,23 @@ private:
 				assert(!"<ERROR>");
 				std::unreachable();
 			},
-			[&](auto& self, std::unique_ptr<symbol_expr>& expr)
+			[&](auto& self, symbol_expr* expr)
 			{
 				return this->resolve_var(expr->self)->layout;
 			},
-			[&](auto& self, std::unique_ptr<group_expr>& expr)
+			[&](auto& self, group_expr* expr)
 			{
 				return std::visit(self, expr->self);
 			},
-			[&](auto& self, std::unique_ptr<binary_expr>& expr)
+			[&](auto& self, binary_expr* expr)
 			{
 				return std::visit(self, expr->lhs);
 			},
-			[&](auto& self, std::unique_ptr<prefix_expr>& expr)
+			[&](auto& self, prefix_expr* expr)
 			{
 				return std::visit(self, expr->rhs);
 			},
-			[&](auto& self, std::unique_ptr<suffix_expr>& expr)
+			[&](auto& self, suffix_expr* expr)
 			{	
 				return std::visit(self, expr->lhs);
 			},
@@ -1,17 +1,19 @@
 #pragma once
 
 #include <vector>
-#include <memory>
 #include <cassert>
 #include <cstdint>
 #include <variant>
 #include <optional>
+#include <functional>
+#include <type_traits>
 
 #include "./span.hpp"
 #include "./token.hpp"
 #include "./error.hpp"
 
 #include "models/str.hpp"
+#include "models/arena.hpp"
 
 #include "traits/visitable.hpp"
 
@@ -55,67 +57,77 @@ enum class op : uint8_t
 
                   /**\----------------------------\**/
 #define only(...) /**/        __VA_ARGS__         /**/
-#define many(...) /**/  std::vector<__VA_ARGS__>  /**/
+#define many(...) /**/  arena::list<__VA_ARGS__>  /**/
 #define some(...) /**/ std::optional<__VA_ARGS__> /**/
                   /**\----------------------------\**/
 
+//|-------------------------------------------|
+//| nodes live in AST::pool and are never     |
+//| destroyed one by one; hence every handle  |
+//| below is a plain pointer, and every node  |
+//| must be trivially destructible. names are |
+//| UTF-8 slices, also owned by the pool.     |
+//|-------------------------------------------|
+
+typedef utf8::slice word;
+
 using decl = std::variant
 <
-	std::unique_ptr<struct var_decl>,
-	std::unique_ptr<struct fun_decl>,
-	std::unique_ptr<struct model_decl>,
-	std::unique_ptr<struct trait_decl>
+	struct var_decl*,
+	struct fun_decl*,
+	struct model_decl*,
+	struct trait_decl*
 >;
 
 using stmt = std::variant
 <
-	std::unique_ptr<struct if_stmt>,
-	std::unique_ptr<struct for_stmt>,
-	std::unique_ptr<struct match_stmt>,
-	std::unique_ptr<struct while_stmt>,
-	std::unique_ptr<struct block_stmt>,
-	std::unique_ptr<struct break_stmt>,
-	std::unique_ptr<struct return_stmt>,
-	std::unique_ptr<struct iterate_stmt>
+	struct if_stmt*,
+	struct for_stmt*,
+	struct match_stmt*,
+	struct while_stmt*,
+	struct block_stmt*,
+	struct break_stmt*,
+	struct return_stmt*,
+	struct iterate_stmt*
 >;
 
 using expr = std::variant
 <
-	std::unique_ptr<struct prefix_expr>,
-	std::unique_ptr<struct binary_expr>,
-	std::unique_ptr<struct suffix_expr>,
-	std::unique_ptr<struct access_expr>,
-	std::unique_ptr<struct invoke_expr>,
-	std::unique_ptr<struct literal_expr>,
-	std::unique_ptr<struct symbol_expr>,
-	std::unique_ptr<struct group_expr>
+	struct prefix_expr*,
+	struct binary_expr*,
+	struct suffix_expr*,
+	struct access_expr*,
+	struct invoke_expr*,
+	struct literal_expr*,
+	struct symbol_expr*,
+	struct group_expr*
 >;
 
 using node = std::variant
 <
 	// decl
-	std::unique_ptr<var_decl>,
-	std::unique_ptr<fun_decl>,
-	std::unique_ptr<model_decl>,
-	std::unique_ptr<trait_decl>,
+	var_decl*,
+	fun_decl*,
+	model_decl*,
+	trait_decl*,
 	// stmt
-	std::unique_ptr<if_stmt>,
-	std::unique_ptr<for_stmt>,
-	std::unique_ptr<match_stmt>,
-	std::unique_ptr<while_stmt>,
-	std::unique_ptr<block_stmt>,
-	std::unique_ptr<break_stmt>,
-	std::unique_ptr<return_stmt>,
-	std::unique_ptr<iterate_stmt>,
+	if_stmt*,
+	for_stmt*,
+	match_stmt*,
+	while_stmt*,
+	block_stmt*,
+	break_stmt*,
+	return_stmt*,
+	iterate_stmt*,
 	// expr
-	std::unique_ptr<prefix_expr>,
-	std::unique_ptr<binary_expr>,
-	std::unique_ptr<suffix_expr>,
-	std::unique_ptr<access_expr>,
-	std::unique_ptr<invoke_expr>,
-	std::unique_ptr<literal_expr>,
-	std::unique_ptr<symbol_expr>,
-	std::unique_ptr<group_expr>
+	prefix_expr*,
+	binary_expr*,
+	suffix_expr*,
+	access_expr*,
+	invoke_expr*,
+	literal_expr*,
+	symbol_expr*,
+	group_expr*
 >;
 
 template
@@ -127,16 +139,23 @@ struct AST
 {
 	typedef error<A, B> segf;
 
+	// owns every node
+	arena pool;
+
 	many(node) body;
-	many(segf) lint;
+	std::vector<segf> lint;
+
+	// parses a lazy fun_decl's body, if any; false if it fails.
+	// grows pool & lint unguarded, so one thread at a time, per AST
+	std::function<bool(AST&, struct fun_decl*)> wake;
 };
 
 struct var_decl : public span,
 public visitable<var_decl>
 {
 	only(bool) only;
-	only(utf8) name;
-	only(utf8) type;
+	only(word) name;
+	only(word) type;
 	some(expr) init;
 };
 
@@ -145,14 +164,16 @@ public visitable<fun_decl>
 {
 	struct data
 	{
-		only(utf8) name;
-		only(utf8) type;
+		only(word) name;
+		only(word) type;
 	};
 	only(bool) pure;
-	only(utf8) name;
+	only(word) name;
 	many(data) args;
-	only(utf8) type;
+	only(word) type;
 	many(node) body;
+	// [head, tail) of its tokens, until parsed
+	only(uint32_t) lazy[2];
 };
 
 struct model_decl : public span,
@@ -160,10 +181,10 @@ public visitable<model_decl>
 {
 	struct data
 	{
-		only(utf8) name;
-		only(utf8) type;
+		only(word) name;
+		only(word) type;
 	};
-	only(utf8) name;
+	only(word) name;
 	many(data) body;
 };
 
@@ -172,12 +193,12 @@ public visitable<trait_decl>
 {
 	struct data
 	{
-		only(utf8) name;
-		many(utf8) args;
-		only(utf8) type;
+		only(word) name;
+		many(word) args;
+		only(word) type;
 		many(node) body;
 	};
-	only(utf8) name;
+	only(word) name;
 	many(data) body;
 };
 
@@ -229,7 +250,7 @@ public visitable<block_stmt>
 struct break_stmt : public span,
 public visitable<break_stmt>
 {
-	only(utf8) label;
+	only(word) label;
 };
 
 struct return_stmt : public span,
@@ -241,7 +262,7 @@ public visitable<return_stmt>
 struct iterate_stmt : public span,
 public visitable<iterate_stmt>
 {
-	only(utf8) label;
+	only(word) label;
 };
 
 struct prefix_expr : public span,
@@ -270,7 +291,7 @@ struct access_expr : public span,
 public visitable<access_expr>
 {
 	only(expr) lhs;
-	only(utf8) name;
+	only(word) name;
 };
 
 struct invoke_expr : public span,
@@ -284,13 +305,15 @@ struct literal_expr : public span,
 public visitable<literal_expr>
 {
 	only(ty) type;
-	only(utf8) self;
+	only(word) self;
+	// numbers only
+	only(number) value;
 };
 
 struct symbol_expr : public span,
 public visitable<symbol_expr>
 {
-	only(utf8) self;
+	only(word) self;
 };
 
 struct group_expr : public span,
@@ -299,6 +322,27 @@ public visitable<group_expr>
 	only(expr) self;
 };
 
+static_assert(std::is_trivially_destructible_v<var_decl>);
+static_assert(std::is_trivially_destructible_v<fun_decl>);
+static_assert(std::is_trivially_destructible_v<model_decl>);
+static_assert(std::is_trivially_destructible_v<trait_decl>);
+static_assert(std::is_trivially_destructible_v<if_stmt>);
+static_assert(std::is_trivially_destructible_v<for_stmt>);
+static_assert(std::is_trivially_destructible_v<match_stmt>);
+static_assert(std::is_trivially_destructible_v<while_stmt>);
+static_assert(std::is_trivially_destructible_v<block_stmt>);
+static_assert(std::is_trivially_destructible_v<break_stmt>);
+static_assert(std::is_trivially_destructible_v<return_stmt>);
+static_assert(std::is_trivially_destructible_v<iterate_stmt>);
+static_assert(std::is_trivially_destructible_v<prefix_expr>);
+static_assert(std::is_trivially_destructible_v<binary_expr>);
+static_assert(std::is_trivially_destructible_v<suffix_expr>);
+static_assert(std::is_trivially_destructible_v<access_expr>);
+static_assert(std::is_trivially_destructible_v<invoke_expr>);
+static_assert(std::is_trivially_destructible_v<literal_expr>);
+static_assert(std::is_trivially_destructible_v<symbol_expr>);
+static_assert(std::is_trivially_destructible_v<group_expr>);
+
 #undef only
 #undef some
 #undef many
@@ -25,13 +25,12 @@ public:
 
 	error
 	(
-		decltype(x) x,
-		decltype(y) y,
+		span pos,
 		decltype(src) src,
 		decltype(msg) msg
 	)
 	:
-	span {x, y}, src {src}, msg {msg} {}
+	span {pos}, src {src}, msg {msg} {}
 
 	//|-----------------|
 	//| member function |
@@ -47,6 +46,9 @@ public:
 
 	friend constexpr auto operator<<(std::ostream& os, const error& error) -> std::ostream&
 	{
+		// resolved on demand
+		const auto [line, column] {error.src->locate(error.offset)};
+
 		return
 		(
 			os
@@ -57,11 +59,11 @@ public:
 			<<
 			"("
 			<<
-			std::setfill('0') << std::setw(2) << error.y + 0
+			std::setfill('0') << std::setw(2) << line
 			<<
 			":"
 			<<
-			std::setfill('0') << std::setw(2) << error.x + 1
+			std::setfill('0') << std::setw(2) << column
 			<<
 			")"
 			<<
@@ -0,0 +1,1303 @@
+#pragma once
+
+#include <bit>
+#include <span>
+#include <tuple>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <utility>
+#include <variant>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+
+#include "./ast.hpp"
+#include "./span.hpp"
+#include "./token.hpp"
+
+#include "models/str.hpp"
+#include "models/arena.hpp"
+
+//|---------------------------------------------|
+//| the AST as flat arrays, by 32-bit node id.  |
+//|                                             |
+//| kind[id] says which table payload[id] is an |
+//| index into; children are ids, and lists of  |
+//| them are [head, head + size) of edges. ids  |
+//| are handed out in pre-order, so a parent    |
+//| always precedes its children. no pointers;  |
+//| every array can be written out as is.       |
+//|---------------------------------------------|
+
+#define nodes(macro)               \
+/*|------|*/                       \
+/*| decl |*/                       \
+/*|------|*/                       \
+macro(VAR_DECL, var_decl)          \
+macro(FUN_DECL, fun_decl)          \
+macro(MODEL_DECL, model_decl)      \
+macro(TRAIT_DECL, trait_decl)      \
+/*|------|*/                       \
+/*| stmt |*/                       \
+/*|------|*/                       \
+macro(IF_STMT, if_stmt)            \
+macro(FOR_STMT, for_stmt)          \
+macro(MATCH_STMT, match_stmt)      \
+macro(WHILE_STMT, while_stmt)      \
+macro(BLOCK_STMT, block_stmt)      \
+macro(BREAK_STMT, break_stmt)      \
+macro(RETURN_STMT, return_stmt)    \
+macro(ITERATE_STMT, iterate_stmt)  \
+/*|------|*/                       \
+/*| expr |*/                       \
+/*|------|*/                       \
+macro(PREFIX_EXPR, prefix_expr)    \
+macro(BINARY_EXPR, binary_expr)    \
+macro(SUFFIX_EXPR, suffix_expr)    \
+macro(ACCESS_EXPR, access_expr)    \
+macro(INVOKE_EXPR, invoke_expr)    \
+macro(LITERAL_EXPR, literal_expr)  \
+macro(SYMBOL_EXPR, symbol_expr)    \
+macro(GROUP_EXPR, group_expr)      \
+
+class flat
+{
+public:
+
+	typedef uint32_t id;
+
+	// no child
+	static constexpr const id NONE {UINT32_MAX};
+
+	#define macro(K, T) K,
+	enum class kind : uint8_t
+	{
+		nodes(macro)
+	};
+	#undef macro
+
+	// [head, head + size) of text
+	struct chars
+	{
+		uint32_t head;
+		uint32_t size;
+	};
+
+	// [head, head + size) of edges, words or methods
+	struct range
+	{
+		uint32_t head;
+		uint32_t size;
+	};
+
+	//|-------------------------------|
+	//| payloads; one table per kind. |
+	//| (name, type) pairs go to      |
+	//| words, (if, then) pairs to    |
+	//| edges, 2 entries each.        |
+	//|-------------------------------|
+
+	template
+	<
+		typename T
+	>
+	struct row;
+
+	// see trait_decl::data
+	struct method
+	{
+		chars name;
+		range args; // words
+		chars type;
+		range body; // edges
+	};
+
+private:
+
+	// by node id
+	std::vector<kind> kinds;
+	std::vector<uint32_t> offset;
+	std::vector<uint32_t> length;
+	std::vector<uint32_t> payload;
+
+	std::vector<id> edges;
+	std::vector<chars> words;
+	std::vector<method> methods;
+	std::vector<char8_t> text;
+
+public:
+
+	// see span::file
+	uint32_t file {0};
+	// top-level nodes, in order
+	std::vector<id> body;
+
+	//|-----------------|
+	//| member function |
+	//|-----------------|
+
+	inline constexpr auto size() const -> size_t
+	{
+		return this->kinds.size();
+	}
+
+	inline constexpr auto type(const id id) const -> kind
+	{
+		return this->kinds[id];
+	}
+
+	inline constexpr auto pos(const id id) const -> span
+	{
+		return {this->file, this->offset[id], this->length[id]};
+	}
+
+	template
+	<
+		typename T
+	>
+	inline constexpr auto at(const id id) const -> const row<T>&
+	{
+		return this->table<T>()[this->payload[id]];
+	}
+
+	inline /*Ი︵𐑼*/ auto str(const chars& str) const -> word
+	{
+		return {this->text.data() + str.head, this->text.data() + str.head + str.size};
+	}
+
+	inline constexpr auto list(const range& range) const -> std::pair<const id*, const id*>
+	{
+		return {this->edges.data() + range.head, this->edges.data() + range.head + range.size};
+	}
+
+	// # of bytes in use
+	inline /*Ი︵𐑼*/ auto bytes() const -> size_t;
+
+	//|---------------------------------------------|
+	//| .moeast; a header, then every array as is,  |
+	//| each 8-byte aligned. offsets only, hence    |
+	//| position independent. load() rejects other |
+	//| versions, layouts, byte orders & hashes.    |
+	//|---------------------------------------------|
+
+	// bump on any change to the format
+	static constexpr const uint32_t VERSION {2};
+
+	inline /*Ი︵𐑼*/ auto save(std::ostream& os, const uint64_t hash) const;
+
+	static inline /*Ი︵𐑼*/ auto load(std::span<const std::byte> data, const uint64_t hash) -> std::optional<flat>;
+
+	// calls f(row<T>) for the kind of id; f may be a fix{visitor<R>(...)}
+	template
+	<
+		typename F
+	>
+	inline constexpr auto visit(F&& f, const id id) const -> decltype(auto)
+	{
+		switch (this->kinds[id])
+		{
+			#define macro(K, T)                      \
+			case kind::K:                            \
+			{                                        \
+				return f(this->template at<T>(id));  \
+			}                                        \
+
+			nodes(macro)
+			#undef macro
+		}
+		assert(!"<ERROR>");
+		std::unreachable();
+	}
+
+	//|-------------------|
+	//| tree <-> flat     |
+	//|-------------------|
+
+	// nullopt while a fun body is lazy; AST::wake it first
+	template
+	<
+		typename A,
+		typename B
+	>
+	static inline /*Ი︵𐑼*/ auto from(const AST<A, B>& exe) -> std::optional<flat>;
+
+	// back into pointer nodes, owned by exe.pool
+	template
+	<
+		typename A,
+		typename B
+	>
+	inline /*Ი︵𐑼*/ auto into(AST<A, B>& exe) const;
+
+private:
+
+	template
+	<
+		typename T
+	>
+	inline constexpr auto table() const -> const std::vector<row<T>>&;
+
+	template
+	<
+		typename T
+	>
+	inline constexpr auto table() -> std::vector<row<T>>&;
+
+	// number <-> (index, bits)
+	static inline /*Ი︵𐑼*/ auto pack(const number& value) -> std::pair<uint8_t, uint64_t>;
+	static inline /*Ი︵𐑼*/ auto unpack(const uint8_t index, const uint64_t bits) -> number;
+
+	inline /*Ი︵𐑼*/ auto intern(const word& str) -> chars;
+	inline /*Ი︵𐑼*/ auto expand(arena& pool, const chars& str) const -> word;
+
+	// any pointer variant
+	template
+	<
+		typename... T
+	>
+	inline /*Ი︵𐑼*/ auto add(const std::variant<T...>& ast) -> id;
+
+	template
+	<
+		typename T
+	>
+	inline /*Ი︵𐑼*/ auto add(const T* ast) -> id;
+
+	template
+	<
+		typename V
+	>
+	// node id -> pointer variant V
+	inline /*Ი︵𐑼*/ auto get(arena& pool, const id id) const -> V;
+
+	struct header
+	{
+		char magic[8];
+		uint32_t version;
+		// sizeof every element, mixed
+		uint32_t layout;
+		uint64_t hash;
+	};
+
+	// every array, in file order
+	inline constexpr auto arrays()
+	{
+		#define macro(K, T) this->table<T>(),
+		return std::tie
+		(
+			this->kinds,
+			this->offset,
+			this->length,
+			this->payload,
+			this->edges,
+			this->words,
+			this->methods,
+			this->text,
+			nodes(macro)
+			this->body
+		);
+		#undef macro
+	}
+
+	inline constexpr auto arrays() const
+	{
+		// as const
+		return std::apply([](const auto&... list)
+		{
+			return std::tie(list...);
+		},
+		const_cast<flat*>(this)->arrays());
+	}
+
+	static inline /*Ი︵𐑼*/ auto layout() -> uint32_t;
+
+	// every index in range, every node owned once; for load()
+	inline /*Ი︵𐑼*/ auto valid() const -> bool;
+
+	// a lazy fun body was met; see from()
+	bool lazy {false};
+
+	// storage
+	#define macro(K, T) std::vector<row<struct T>>,
+	std::tuple
+	<
+		nodes(macro)
+		std::monostate
+	>
+	rows;
+	#undef macro
+};
+
+//|-------------------------------|
+//| payloads; written out as is,  |
+//| so every byte is a field. no  |
+//| bool, no std::variant, and    |
+//| padding is spelled out.       |
+//|-------------------------------|
+
+template<> struct flat::row<var_decl>
+{
+	uint8_t only;
+	uint8_t pad[3] {};
+	chars name;
+	chars type;
+	id init;
+};
+
+template<> struct flat::row<fun_decl>
+{
+	uint8_t pure;
+	uint8_t pad[3] {};
+	chars name;
+	range args; // words, pairs
+	chars type;
+	range body; // edges
+};
+
+template<> struct flat::row<model_decl>
+{
+	chars name;
+	range body; // words, pairs
+};
+
+template<> struct flat::row<trait_decl>
+{
+	chars name;
+	range body; // methods
+};
+
+template<> struct flat::row<if_stmt>
+{
+	range body; // edges, pairs
+};
+
+template<> struct flat::row<for_stmt>
+{
+	id init;
+	id _if_;
+	id task;
+	id body;
+};
+
+template<> struct flat::row<match_stmt>
+{
+	id data;
+	range body; // edges, pairs
+};
+
+template<> struct flat::row<while_stmt>
+{
+	id _if_;
+	id body;
+};
+
+template<> struct flat::row<block_stmt>
+{
+	range body; // edges
+};
+
+template<> struct flat::row<break_stmt>
+{
+	chars label;
+};
+
+template<> struct flat::row<return_stmt>
+{
+	id value;
+};
+
+template<> struct flat::row<iterate_stmt>
+{
+	chars label;
+};
+
+template<> struct flat::row<prefix_expr>
+{
+	op op;
+	uint8_t pad[3] {};
+	id rhs;
+};
+
+template<> struct flat::row<binary_expr>
+{
+	id lhs;
+	op op;
+	uint8_t pad[3] {};
+	id rhs;
+};
+
+template<> struct flat::row<suffix_expr>
+{
+	id lhs;
+	op oper;
+	uint8_t pad[3] {};
+};
+
+template<> struct flat::row<access_expr>
+{
+	id lhs;
+	chars name;
+};
+
+template<> struct flat::row<invoke_expr>
+{
+	id lhs;
+	range args; // edges
+};
+
+template<> struct flat::row<literal_expr>
+{
+	// see flat::pack
+	uint64_t bits;
+	uint8_t index;
+	ty type;
+	uint8_t pad[6] {};
+	chars self;
+};
+
+template<> struct flat::row<symbol_expr>
+{
+	chars self;
+};
+
+template<> struct flat::row<group_expr>
+{
+	id self;
+};
+
+//|----------------|
+//| implementation |
+//|----------------|
+
+template
+<
+	typename T
+>
+inline constexpr auto flat::table() const -> const std::vector<row<T>>&
+{
+	return std::get<std::vector<row<T>>>(this->rows);
+}
+
+template
+<
+	typename T
+>
+inline constexpr auto flat::table() -> std::vector<row<T>>&
+{
+	return std::get<std::vector<row<T>>>(this->rows);
+}
+
+inline /*Ი︵𐑼*/ auto flat::bytes() const -> size_t
+{
+	return std::apply([](const auto&... list)
+	{
+		return (size_t {0} + ... + (list.size() * sizeof(list[0])));
+	},
+	this->arrays());
+}
+
+inline /*Ი︵𐑼*/ auto flat::layout() -> uint32_t
+{
+	uint32_t out {0x811C9DC5};
+
+	std::apply([&](const auto&... list)
+	{
+		((out = (out ^ sizeof(list[0])) * 0x01000193), ...);
+	},
+	flat {}.arrays());
+
+	// byte order
+	return out ^ (std::endian::native == std::endian::little);
+}
+
+inline /*Ი︵𐑼*/ auto flat::save(std::ostream& os, const uint64_t hash) const
+{
+	const header head {{'m', 'o', 'e', 'a', 's', 't'}, VERSION, flat::layout(), hash};
+
+	os.write(reinterpret_cast<const char*>(&head), sizeof(head));
+
+	std::apply([&](const auto&... list)
+	{
+		const uint64_t size[] {list.size()...};
+
+		os.write(reinterpret_cast<const char*>(size), sizeof(size));
+	},
+	this->arrays());
+
+	std::apply([&](const auto&... list)
+	{
+		static_assert((std::has_unique_object_representations_v<typename std::remove_cvref_t<decltype(list)>::value_type> && ...), "padding would be written out");
+
+		static constexpr const char pad[8] {};
+
+		((
+			os.write(reinterpret_cast<const char*>(list.data()), list.size() * sizeof(list[0])),
+			os.write(pad, -(list.size() * sizeof(list[0])) & 7)
+		), ...);
+	},
+	this->arrays());
+}
+
+inline /*Ი︵𐑼*/ auto flat::load(std::span<const std::byte> data, const uint64_t hash) -> std::optional<flat>
+{
+	flat out;
+
+	constexpr auto count {std::tuple_size_v<decltype(out.arrays())>};
+
+	header head;
+
+	if (data.size() < sizeof(head) + count * 8)
+	{
+		return std::nullopt;
+	}
+	std::memcpy(&head, data.data(), sizeof(head));
+
+	if
+	(
+		std::memcmp(head.magic, "moeast", 6) != 0
+		||
+		head.version != VERSION
+		||
+		head.layout != flat::layout()
+		||
+		head.hash != hash
+	)
+	{
+		return std::nullopt;
+	}
+
+	uint64_t size[count];
+
+	std::memcpy(size, data.data() + sizeof(head), sizeof(size));
+
+	size_t at {sizeof(head) + sizeof(size)};
+	size_t nth {0};
+
+	const auto fine {std::apply([&](auto&... list)
+	{
+		return ([&]
+		{
+			const auto len {size[nth++]};
+
+			if ((data.size() - std::min(at, data.size())) / sizeof(list[0]) < len)
+			{
+				return false; // truncated
+			}
+			if (len != 0)
+			{
+				list.resize(len);
+
+				std::memcpy(list.data(), data.data() + at, len * sizeof(list[0]));
+			}
+
+			at += (len * sizeof(list[0]) + 7) & ~size_t {7};
+
+			return true;
+		}
+		() && ...);
+	},
+	out.arrays())};
+
+	if (!fine || !out.valid())
+	{
+		return std::nullopt;
+	}
+	return out;
+}
+
+inline /*Ი︵𐑼*/ auto flat::valid() const -> bool
+{
+	const auto size {this->kinds.size()};
+
+	if (NONE <= size || this->offset.size() != size || this->length.size() != size || this->payload.size() != size)
+	{
+		return false;
+	}
+
+	typedef std::pair<kind, kind> group;
+
+	static constexpr const group ANY {kind::VAR_DECL, kind::GROUP_EXPR};
+	static constexpr const group STMT {kind::IF_STMT, kind::ITERATE_STMT};
+	static constexpr const group EXPR {kind::PREFIX_EXPR, kind::GROUP_EXPR};
+
+	#define macro(K, V) + 1
+	static constexpr const size_t OPS {0 operators(macro)};
+	#undef macro
+
+	// referenced once, by a node before it; hence no cycles
+	std::vector<bool> seen(size);
+
+	const auto child {[&](const id parent, const id id, const group& of) -> bool
+	{
+		if (id == NONE)
+		{
+			return true;
+		}
+		if (id <= parent || size <= id || seen[id] || this->kinds[id] < of.first || of.second < this->kinds[id])
+		{
+			return false;
+		}
+		return seen[id] = true;
+	}};
+
+	const auto str {[&](const chars& it) -> bool
+	{
+		return uint64_t {it.head} + it.size <= this->text.size();
+	}};
+
+	// k entries per item
+	const auto within {[](const range& range, const auto& list, const uint64_t k) -> bool
+	{
+		return range.head + range.size * k <= list.size();
+	}};
+
+	const auto list {[&](const id parent, const range& range, const group& of) -> bool
+	{
+		if (!within(range, this->edges, 1))
+		{
+			return false;
+		}
+		for (uint32_t i {0}; i < range.size; ++i)
+		{
+			if (!child(parent, this->edges[range.head + i], of))
+			{
+				return false;
+			}
+		}
+		return true;
+	}};
+
+	const auto flows {[&](const id parent, const range& range) -> bool
+	{
+		if (!within(range, this->edges, 2))
+		{
+			return false;
+		}
+		for (uint32_t i {0}; i < range.size; ++i)
+		{
+			if (!child(parent, this->edges[range.head + i * 2 + 0], EXPR) || !child(parent, this->edges[range.head + i * 2 + 1], STMT))
+			{
+				return false;
+			}
+		}
+		return true;
+	}};
+
+	if (!std::ranges::all_of(this->words, str))
+	{
+		return false;
+	}
+	for (const auto id : this->body)
+	{
+		if (size <= id || seen[id])
+		{
+			return false;
+		}
+		seen[id] = true;
+	}
+
+	for (id id {0}; id < size; ++id)
+	{
+		switch (this->kinds[id])
+		{
+			#define macro(K, T)                                          \
+			case kind::K:                                                \
+			{                                                            \
+				if (this->table<T>().size() <= this->payload[id])        \
+				{                                                        \
+					return false;                                        \
+				}                                                        \
+				break;                                                   \
+			}                                                            \
+
+			nodes(macro)
+			#undef macro
+
+			default:
+			{
+				return false;
+			}
+		}
+
+		const auto fine {this->visit([&]<typename R>(const R& data) -> bool
+		{
+			if constexpr (std::is_same_v<R, row<var_decl>>)
+			{
+				return data.only <= 1 && str(data.name) && str(data.type) && child(id, data.init, EXPR);
+			}
+			if constexpr (std::is_same_v<R, row<fun_decl>>)
+			{
+				return data.pure <= 1 && str(data.name) && within(data.args, this->words, 2) && str(data.type) && list(id, data.body, ANY);
+			}
+			if constexpr (std::is_same_v<R, row<model_decl>>)
+			{
+				return str(data.name) && within(data.body, this->words, 2);
+			}
+			if constexpr (std::is_same_v<R, row<trait_decl>>)
+			{
+				if (!str(data.name) || !within(data.body, this->methods, 1))
+				{
+					return false;
+				}
+				for (uint32_t i {0}; i < data.body.size; ++i)
+				{
+					const auto& it {this->methods[data.body.head + i]};
+
+					if (!str(it.name) || !within(it.args, this->words, 1) || !str(it.type) || !list(id, it.body, ANY))
+					{
+						return false;
+					}
+				}
+				return true;
+			}
+			if constexpr (std::is_same_v<R, row<if_stmt>>)
+			{
+				return flows(id, data.body);
+			}
+			if constexpr (std::is_same_v<R, row<for_stmt>>)
+			{
+				return child(id, data.init, EXPR) && child(id, data._if_, EXPR) && child(id, data.task, EXPR) && child(id, data.body, STMT);
+			}
+			if constexpr (std::is_same_v<R, row<match_stmt>>)
+			{
+				return child(id, data.data, EXPR) && flows(id, data.body);
+			}
+			if constexpr (std::is_same_v<R, row<while_stmt>>)
+			{
+				return child(id, data._if_, EXPR) && child(id, data.body, STMT);
+			}
+			if constexpr (std::is_same_v<R, row<block_stmt>>)
+			{
+				return list(id, data.body, ANY);
+			}
+			if constexpr (std::is_same_v<R, row<break_stmt>> || std::is_same_v<R, row<iterate_stmt>>)
+			{
+				return str(data.label);
+			}
+			if constexpr (std::is_same_v<R, row<return_stmt>>)
+			{
+				return child(id, data.value, EXPR);
+			}
+			if constexpr (std::is_same_v<R, row<prefix_expr>>)
+			{
+				return static_cast<size_t>(data.op) < OPS && child(id, data.rhs, EXPR);
+			}
+			if constexpr (std::is_same_v<R, row<binary_expr>>)
+			{
+				return child(id, data.lhs, EXPR) && static_cast<size_t>(data.op) < OPS && child(id, data.rhs, EXPR);
+			}
+			if constexpr (std::is_same_v<R, row<suffix_expr>>)
+			{
+				return child(id, data.lhs, EXPR) && static_cast<size_t>(data.oper) < OPS;
+			}
+			if constexpr (std::is_same_v<R, row<access_expr>>)
+			{
+				return child(id, data.lhs, EXPR) && str(data.name);
+			}
+			if constexpr (std::is_same_v<R, row<invoke_expr>>)
+			{
+				return child(id, data.lhs, EXPR) && list(id, data.args, EXPR);
+			}
+			if constexpr (std::is_same_v<R, row<literal_expr>>)
+			{
+				return data.type <= ty::NONE && str(data.self) && data.index < std::variant_size_v<number>;
+			}
+			if constexpr (std::is_same_v<R, row<symbol_expr>>)
+			{
+				return str(data.self);
+			}
+			if constexpr (std::is_same_v<R, row<group_expr>>)
+			{
+				return child(id, data.self, EXPR);
+			}
+		},
+		id)};
+
+		if (!fine)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+inline /*Ი︵𐑼*/ auto flat::pack(const number& value) -> std::pair<uint8_t, uint64_t>
+{
+	return std::visit([&]<typename T>(const T& data) -> std::pair<uint8_t, uint64_t>
+	{
+		if constexpr (std::is_same_v<T, std::monostate>)
+		{
+			return {static_cast<uint8_t>(value.index()), 0};
+		}
+		else
+		{
+			return {static_cast<uint8_t>(value.index()), std::bit_cast<uint64_t>(data)};
+		}
+	},
+	value);
+}
+
+inline /*Ი︵𐑼*/ auto flat::unpack(const uint8_t index, const uint64_t bits) -> number
+{
+	number out;
+
+	[&]<size_t... N>(std::index_sequence<N...>)
+	{
+		([&]
+		{
+			typedef std::variant_alternative_t<N, number> T;
+
+			if constexpr (!std::is_same_v<T, std::monostate>)
+			{
+				if (N == index)
+				{
+					out.template emplace<N>(std::bit_cast<T>(bits));
+				}
+			}
+		}
+		(), ...);
+	}
+	(std::make_index_sequence<std::variant_size_v<number>> {});
+
+	return out;
+}
+
+inline /*Ი︵𐑼*/ auto flat::intern(const word& str) -> chars
+{
+	const chars out {static_cast<uint32_t>(this->text.size()), static_cast<uint32_t>(str.size())};
+
+	this->text.insert(this->text.end(), &str.begin(), &str.end());
+
+	return out;
+}
+
+inline /*Ი︵𐑼*/ auto flat::expand(arena& pool, const chars& str) const -> word
+{
+	auto* ptr {pool.array<char8_t>(str.size)};
+
+	std::ranges::copy(this->text.begin() + str.head, this->text.begin() + str.head + str.size, ptr);
+
+	return {ptr, ptr + str.size};
+}
+
+template
+<
+	typename... T
+>
+inline /*Ი︵𐑼*/ auto flat::add(const std::variant<T...>& ast) -> id
+{
+	return std::visit([&](const auto* ptr) -> id
+	{
+		return ptr ? this->add(ptr) : NONE;
+	},
+	ast);
+}
+
+template
+<
+	typename T
+>
+inline /*Ი︵𐑼*/ auto flat::add(const T* ast) -> id
+{
+	#define macro(K, U) if constexpr (std::is_same_v<T, U>) { this->kinds.emplace_back(kind::K); }
+	nodes(macro)
+	#undef macro
+
+	const auto out {static_cast<id>(this->kinds.size() - 1)};
+
+	this->offset.emplace_back(ast->offset);
+	this->length.emplace_back(ast->length);
+	// patched below
+	this->payload.emplace_back(0);
+
+	// children first, then one contiguous run of edges
+	const auto edges {[&](const auto& list) -> range
+	{
+		std::vector<id> ids;
+
+		for (const auto& node : list)
+		{
+			ids.emplace_back(this->add(node));
+		}
+		const range out {static_cast<uint32_t>(this->edges.size()), static_cast<uint32_t>(ids.size())};
+
+		this->edges.insert(this->edges.end(), ids.begin(), ids.end());
+
+		return out;
+	}};
+
+	const auto flows {[&](const auto& list) -> range
+	{
+		std::vector<id> ids;
+
+		for (const auto& flow : list)
+		{
+			ids.emplace_back(this->add(flow._if_));
+			ids.emplace_back(this->add(flow.then));
+		}
+		const range out {static_cast<uint32_t>(this->edges.size()), static_cast<uint32_t>(list.size())};
+
+		this->edges.insert(this->edges.end(), ids.begin(), ids.end());
+
+		return out;
+	}};
+
+	const auto pairs {[&](const auto& list) -> range
+	{
+		const range out {static_cast<uint32_t>(this->words.size()), static_cast<uint32_t>(list.size())};
+
+		for (const auto& it : list)
+		{
+			this->words.emplace_back(this->intern(it.name));
+			this->words.emplace_back(this->intern(it.type));
+		}
+		return out;
+	}};
+
+	row<T> data {};
+
+	if constexpr (std::is_same_v<T, var_decl>)
+	{
+		data.only = ast->only;
+		data.name = this->intern(ast->name);
+		data.type = this->intern(ast->type);
+		data.init = ast->init ? this->add(*ast->init) : NONE;
+	}
+	if constexpr (std::is_same_v<T, fun_decl>)
+	{
+		// its body is not parsed yet
+		this->lazy |= ast->lazy[0] != ast->lazy[1];
+
+		data.pure = ast->pure;
+		data.name = this->intern(ast->name);
+		data.args = pairs(ast->args);
+		data.type = this->intern(ast->type);
+		data.body = edges(ast->body);
+	}
+	if constexpr (std::is_same_v<T, model_decl>)
+	{
+		data.name = this->intern(ast->name);
+		data.body = pairs(ast->body);
+	}
+	if constexpr (std::is_same_v<T, trait_decl>)
+	{
+		data.name = this->intern(ast->name);
+
+		std::vector<method> list;
+
+		for (const auto& it : ast->body)
+		{
+			method out {this->intern(it.name), {static_cast<uint32_t>(this->words.size()), static_cast<uint32_t>(it.args.size())}};
+
+			for (const auto& arg : it.args)
+			{
+				this->words.emplace_back(this->intern(arg));
+			}
+			out.type = this->intern(it.type);
+			out.body = edges(it.body);
+
+			list.emplace_back(out);
+		}
+		data.body = {static_cast<uint32_t>(this->methods.size()), static_cast<uint32_t>(list.size())};
+
+		this->methods.insert(this->methods.end(), list.begin(), list.end());
+	}
+	if constexpr (std::is_same_v<T, if_stmt>)
+	{
+		data.body = flows(ast->body);
+	}
+	if constexpr (std::is_same_v<T, for_stmt>)
+	{
+		data.init = this->add(ast->init);
+		data._if_ = this->add(ast->_if_);
+		data.task = this->add(ast->task);
+		data.body = this->add(ast->body);
+	}
+	if constexpr (std::is_same_v<T, match_stmt>)
+	{
+		data.data = this->add(ast->data);
+		data.body = flows(ast->body);
+	}
+	if constexpr (std::is_same_v<T, while_stmt>)
+	{
+		data._if_ = this->add(ast->_if_);
+		data.body = this->add(ast->body);
+	}
+	if constexpr (std::is_same_v<T, block_stmt>)
+	{
+		data.body = edges(ast->body);
+	}
+	if constexpr (std::is_same_v<T, break_stmt> || std::is_same_v<T, iterate_stmt>)
+	{
+		data.label = this->intern(ast->label);
+	}
+	if constexpr (std::is_same_v<T, return_stmt>)
+	{
+		data.value = this->add(ast->value);
+	}
+	if constexpr (std::is_same_v<T, prefix_expr>)
+	{
+		data.op = ast->op;
+		data.rhs = this->add(ast->rhs);
+	}
+	if constexpr (std::is_same_v<T, binary_expr>)
+	{
+		data.lhs = this->add(ast->lhs);
+		data.op = ast->op;
+		data.rhs = this->add(ast->rhs);
+	}
+	if constexpr (std::is_same_v<T, suffix_expr>)
+	{
+		data.lhs = this->add(ast->lhs);
+		data.oper = ast->oper;
+	}
+	if constexpr (std::is_same_v<T, access_expr>)
+	{
+		data.lhs = this->add(ast->lhs);
+		data.name = this->intern(ast->name);
+	}
+	if constexpr (std::is_same_v<T, invoke_expr>)
+	{
+		data.lhs = this->add(ast->lhs);
+		data.args = edges(ast->args);
+	}
+	if constexpr (std::is_same_v<T, literal_expr>)
+	{
+		data.type = ast->type;
+		data.self = this->intern(ast->self);
+
+		std::tie(data.index, data.bits) = flat::pack(ast->value);
+	}
+	if constexpr (std::is_same_v<T, symbol_expr>)
+	{
+		data.self = this->intern(ast->self);
+	}
+	if constexpr (std::is_same_v<T, group_expr>)
+	{
+		data.self = this->add(ast->self);
+	}
+
+	this->payload[out] = static_cast<uint32_t>(this->table<T>().size());
+
+	this->table<T>().emplace_back(data);
+
+	return out;
+}
+
+template
+<
+	typename A,
+	typename B
+>
+inline /*Ი︵𐑼*/ auto flat::from(const AST<A, B>& exe) -> std::optional<flat>
+{
+	flat out;
+
+	for (const auto& node : exe.body)
+	{
+		if (const auto id {out.add(node)}; id != NONE)
+		{
+			out.file = out.file ? out.file : std::visit([](const auto* ptr) { return ptr->file; }, node);
+
+			out.body.emplace_back(id);
+		}
+	}
+	if (out.lazy)
+	{
+		return std::nullopt;
+	}
+	return out;
+}
+
+template
+<
+	typename V
+>
+inline /*Ი︵𐑼*/ auto flat::get(arena& pool, const id id) const -> V
+{
+	if (id == NONE)
+	{
+		return V {};
+	}
+
+	const auto list {[&]<typename U>(const range& range, arena::list<U>& out)
+	{
+		const auto [head, tail] {this->list(range)};
+
+		for (auto it {head}; it != tail; ++it)
+		{
+			out.emplace_back(pool, this->template get<U>(pool, *it));
+		}
+	}};
+
+	const auto pairs {[&](const range& range, auto& out)
+	{
+		for (uint32_t i {0}; i < range.size; ++i)
+		{
+			out.emplace_back(pool, this->expand(pool, this->words[range.head + i * 2 + 0]), this->expand(pool, this->words[range.head + i * 2 + 1]));
+		}
+	}};
+
+	const auto flows {[&](const range& range, auto& out)
+	{
+		for (uint32_t i {0}; i < range.size; ++i)
+		{
+			out.emplace_back(pool, this->template get<expr>(pool, this->edges[range.head + i * 2 + 0]), this->template get<stmt>(pool, this->edges[range.head + i * 2 + 1]));
+		}
+	}};
+
+	return this->visit([&]<typename R>(const R& data) -> V
+	{
+		auto build {[&]<typename T>(T* ast) -> V
+		{
+			static_cast<span&>(*ast) = this->pos(id);
+
+			if constexpr (std::is_same_v<T, var_decl>)
+			{
+				ast->only = data.only;
+				ast->name = this->expand(pool, data.name);
+				ast->type = this->expand(pool, data.type);
+
+				if (data.init != NONE)
+				{
+					ast->init = this->template get<expr>(pool, data.init);
+				}
+			}
+			if constexpr (std::is_same_v<T, fun_decl>)
+			{
+				ast->pure = data.pure;
+				ast->name = this->expand(pool, data.name);
+				pairs(data.args, ast->args);
+				ast->type = this->expand(pool, data.type);
+				list(data.body, ast->body);
+			}
+			if constexpr (std::is_same_v<T, model_decl>)
+			{
+				ast->name = this->expand(pool, data.name);
+				pairs(data.body, ast->body);
+			}
+			if constexpr (std::is_same_v<T, trait_decl>)
+			{
+				ast->name = this->expand(pool, data.name);
+
+				for (uint32_t i {0}; i < data.body.size; ++i)
+				{
+					const auto& from {this->methods[data.body.head + i]};
+
+					auto& into {ast->body.emplace_back(pool)};
+
+					into.name = this->expand(pool, from.name);
+
+					for (uint32_t j {0}; j < from.args.size; ++j)
+					{
+						into.args.emplace_back(pool, this->expand(pool, this->words[from.args.head + j]));
+					}
+					into.type = this->expand(pool, from.type);
+					list(from.body, into.body);
+				}
+			}
+			if constexpr (std::is_same_v<T, if_stmt>)
+			{
+				flows(data.body, ast->body);
+			}
+			if constexpr (std::is_same_v<T, for_stmt>)
+			{
+				ast->init = this->template get<expr>(pool, data.init);
+				ast->_if_ = this->template get<expr>(pool, data._if_);
+				ast->task = this->template get<expr>(pool, data.task);
+				ast->body = this->template get<stmt>(pool, data.body);
+			}
+			if constexpr (std::is_same_v<T, match_stmt>)
+			{
+				ast->data = this->template get<expr>(pool, data.data);
+				flows(data.body, ast->body);
+			}
+			if constexpr (std::is_same_v<T, while_stmt>)
+			{
+				ast->_if_ = this->template get<expr>(pool, data._if_);
+				ast->body = this->template get<stmt>(pool, data.body);
+			}
+			if constexpr (std::is_same_v<T, block_stmt>)
+			{
+				list(data.body, ast->body);
+			}
+			if constexpr (std::is_same_v<T, break_stmt> || std::is_same_v<T, iterate_stmt>)
+			{
+				ast->label = this->expand(pool, data.label);
+			}
+			if constexpr (std::is_same_v<T, return_stmt>)
+			{
+				ast->value = this->template get<expr>(pool, data.value);
+			}
+			if constexpr (std::is_same_v<T, prefix_expr>)
+			{
+				ast->op = data.op;
+				ast->rhs = this->template get<expr>(pool, data.rhs);
+			}
+			if constexpr (std::is_same_v<T, binary_expr>)
+			{
+				ast->lhs = this->template get<expr>(pool, data.lhs);
+				ast->op = data.op;
+				ast->rhs = this->template get<expr>(pool, data.rhs);
+			}
+			if constexpr (std::is_same_v<T, suffix_expr>)
+			{
+				ast->lhs = this->template get<expr>(pool, data.lhs);
+				ast->oper = data.oper;
+			}
+			if constexpr (std::is_same_v<T, access_expr>)
+			{
+				ast->lhs = this->template get<expr>(pool, data.lhs);
+				ast->name = this->expand(pool, data.name);
+			}
+			if constexpr (std::is_same_v<T, invoke_expr>)
+			{
+				ast->lhs = this->template get<expr>(pool, data.lhs);
+				list(data.args, ast->args);
+			}
+			if constexpr (std::is_same_v<T, literal_expr>)
+			{
+				ast->type = data.type;
+				ast->self = this->expand(pool, data.self);
+				ast->value = flat::unpack(data.index, data.bits);
+			}
+			if constexpr (std::is_same_v<T, symbol_expr>)
+			{
+				ast->self = this->expand(pool, data.self);
+			}
+			if constexpr (std::is_same_v<T, group_expr>)
+			{
+				ast->self = this->template get<expr>(pool, data.self);
+			}
+
+			if constexpr (std::is_constructible_v<V, T*>)
+			{
+				return ast;
+			}
+			assert(!"<ERROR>");
+			std::unreachable();
+		}};
+
+		#define macro(K, U) if constexpr (std::is_same_v<R, row<U>>) { return build(pool.template make<U>()); }
+		nodes(macro)
+		#undef macro
+	},
+	id);
+}
+
+template
+<
+	typename A,
+	typename B
+>
+inline /*Ი︵𐑼*/ auto flat::into(AST<A, B>& exe) const
+{
+	for (const auto id : this->body)
+	{
+		exe.body.emplace_back(exe.pool, this->template get<node>(exe.pool, id));
+	}
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <utility>
+#include <optional>
+
+#include "./token.hpp"
+
+#include "models/phf.hpp"
+#include "models/tst.hpp"
+
+#include "utils/unicode.hpp"
+
+//|------------------------------------------|
+//| every table below is built at compile    |
+//| time from the X-macros in token.hpp, so  |
+//| the lexer pays nothing at startup.       |
+//|                                          |
+//| words -> starts with XID_Start -> PHF    |
+//| marks -> everything else       -> TST    |
+//|------------------------------------------|
+
+namespace lexicon
+{
+	namespace // private
+	{
+		#define macro(K, V) std::pair<const char8_t*, atom> {V, atom::K},
+
+		constexpr const std::pair<const char8_t*, atom> TBL[]
+		{
+			delimeters(macro)
+			operators(macro)
+			keywords(macro)
+			special(macro)
+		};
+		#undef macro
+
+		constexpr auto is_word(const char8_t* key) -> bool
+		{
+			return utils::props(key[0]).XID_Start;
+		}
+
+		constexpr auto is_mark(const char8_t* key) -> bool
+		{
+			return !utils::props(key[0]).XID_Start;
+		}
+	}
+
+	//|--------------------------------|
+	//| ASCII character classes; the   |
+	//| unicode tables are only looked |
+	//| up for code points >= 0x80     |
+	//|--------------------------------|
+
+	struct kind
+	{
+		bool space : 1 {false};
+		bool digit : 1 {false};
+		bool quote : 1 {false};
+		// XID_Start
+		bool head : 1 {false};
+		// XID_Continue
+		bool body : 1 {false};
+		// operator start
+		bool mark : 1 {false};
+	};
+
+	constexpr const auto ascii {[]
+	{
+		std::array<kind, 0x80> out {};
+
+		for (char32_t code {0}; code < 0x80; ++code)
+		{
+			out[code].space = code == ' ' || code == '\t' || code == '\n';
+			out[code].digit = '0' <= code && code <= '9';
+			out[code].quote = code == '\'' || code == '\"';
+			out[code].head = utils::props(code).XID_Start;
+			out[code].body = utils::props(code).XID_Continue;
+		}
+		for (const auto& [key, _] : TBL)
+		{
+			if (key != nullptr && is_mark(key))
+			{
+				assert(key[0] < 0x80);
+
+				out[key[0]].mark = true;
+			}
+		}
+		return out;
+	}()};
+
+	// see utils::skip_word
+	static_assert([]
+	{
+		for (char32_t code {0}; code < 0x80; ++code)
+		{
+			const auto word
+			{
+				('0' <= code && code <= '9')
+				||
+				('a' <= (code | 0x20) && (code | 0x20) <= 'z')
+				||
+				code == '_'
+			};
+			if (ascii[code].body != word)
+			{
+				return false;
+			}
+		}
+		return true;
+	}());
+
+	inline constexpr auto is_head(const char32_t code) -> bool
+	{
+		return code < 0x80 ? ascii[code].head : utils::props(code).XID_Start;
+	}
+
+	inline constexpr auto is_body(const char32_t code) -> bool
+	{
+		return code < 0x80 ? ascii[code].body : utils::props(code).XID_Continue;
+	}
+
+	//|--------------------------------|
+	//| keywords, word-like operators, |
+	//| null, true & false             |
+	//|--------------------------------|
+
+	constexpr const phf<atom, 128> words {TBL, is_word};
+
+	//|--------------------------------|
+	//| delimeters, operators & '@xxx' |
+	//|--------------------------------|
+
+	constexpr const tst<atom>::frozen<tst<atom>::count(TBL, is_mark)> marks {TBL, is_mark};
+
+	// longest mark, in UTF-8 code units; see lexer::LOOKAHEAD
+	constexpr const size_t reach {[]
+	{
+		size_t out {0};
+
+		for (const auto& [key, _] : TBL)
+		{
+			if (key != nullptr && is_mark(key))
+			{
+				size_t len {0};
+
+				for (; key[len] != u8'\0'; ++len);
+
+				out = len < out ? out : len;
+			}
+		}
+		return out;
+	}()};
+}
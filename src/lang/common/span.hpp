@@ -3,23 +3,33 @@
 #include <cstdint>
 #include <compare>
 
+//|------------------------------------|
+//| 12 bytes; line & column are looked |
+//| up in the file's line table when a |
+//| diagnostic is rendered.            |
+//|------------------------------------|
+
 struct span
 {
-	uint16_t x;
-	uint16_t y;
+	// fs::file::id
+	uint32_t file;
+	// in code units
+	uint32_t offset;
+	uint32_t length;
 
 	inline constexpr auto operator<=>(const span& rhs) const
 	{
 		return
 		(
-			this->y != rhs.y
+			this->file != rhs.file
 			?
-			this->y <=> rhs.y
+			this->file <=> rhs.file
 			:
-			this->x <=> rhs.x
+			this->offset <=> rhs.offset
 		);
 	}
 };
 
-static_assert(span { .x {1}, .y {0} } < span { .x {0}, .y {1} });
-static_assert(span { .x {0}, .y {2} } < span { .x {1}, .y {2} });
+static_assert(sizeof(span) == 12);
+static_assert(span { .file {0}, .offset {9} } < span { .file {1}, .offset {0} });
+static_assert(span { .file {1}, .offset {0x10000} } > span { .file {1}, .offset {0xFFFF} });
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <variant>
+#include <algorithm>
+
+#include "core/fs.hpp"
+
+#include "./eof.hpp"
+#include "./span.hpp"
+#include "./token.hpp"
+#include "./error.hpp"
+
+#include "models/str.hpp"
+
+//|-------------------------------------|
+//| every token of a file, as parallel  |
+//| arrays. tokens are rebuilt from the |
+//| arrays on access, by index.         |
+//|-------------------------------------|
+
+template
+<
+	model::text A,
+	model::text B
+>
+struct tape
+{
+	//|-----<file>-----|
+	fs::file<A, B>* src;
+	//|----------------|
+	std::vector<atom> type;
+	std::vector<uint32_t> offset;
+	std::vector<uint32_t> length;
+	// (index, error); sorted by index
+	std::vector<std::pair<uint32_t, error<A, B>>> lint;
+	// (index, value); sorted by index
+	std::vector<std::pair<uint32_t, number>> value;
+
+	//|-----------------|
+	//| member function |
+	//|-----------------|
+
+	inline constexpr auto size() const -> size_t
+	{
+		return this->type.size();
+	}
+
+	inline constexpr auto reserve(const size_t size)
+	{
+		this->type.reserve(size);
+		this->offset.reserve(size);
+		this->length.reserve(size);
+	}
+
+	inline constexpr auto push(const atom type, const uint32_t offset, const uint32_t length)
+	{
+		this->type.emplace_back(type);
+		this->offset.emplace_back(offset);
+		this->length.emplace_back(length);
+	}
+
+	inline constexpr auto push(const token<A, B>& arg)
+	{
+		if (!std::holds_alternative<std::monostate>(arg.value))
+		{
+			this->value.emplace_back(this->size(), arg.value);
+		}
+		this->push(arg.type, arg.offset, arg.length);
+	}
+
+	inline constexpr auto push(const error<A, B>& arg)
+	{
+		this->lint.emplace_back(this->size(), arg);
+		// placeholder
+		this->push({}, arg.offset, arg.length);
+	}
+
+	// [from, to) of another tape, moved by shift units
+	inline constexpr auto append(const tape& other, const size_t from, size_t to = SIZE_MAX, const int64_t shift = 0)
+	{
+		to = std::min(to, other.size());
+
+		for (auto [nth, error] : other.lint)
+		{
+			if (from <= nth && nth < to)
+			{
+				error.src = this->src;
+				error.file = this->src->id;
+				error.offset += shift;
+
+				this->lint.emplace_back(nth - from + this->size(), error);
+			}
+		}
+		for (const auto& [nth, value] : other.value)
+		{
+			if (from <= nth && nth < to)
+			{
+				this->value.emplace_back(nth - from + this->size(), value);
+			}
+		}
+		this->type.insert(this->type.end(), other.type.begin() + from, other.type.begin() + to);
+		this->length.insert(this->length.end(), other.length.begin() + from, other.length.begin() + to);
+
+		for (size_t i {from}; i < to; ++i)
+		{
+			this->offset.emplace_back(other.offset[i] + shift);
+		}
+	}
+
+	// getter
+	inline constexpr auto operator[](const uint32_t nth) const -> std::variant<token<A, B>, error<A, B>, eof>
+	{
+		if (this->size() <= nth)
+		{
+			return eof {};
+		}
+
+		if (const auto* out {tape::find(this->lint, nth)})
+		{
+			return *out;
+		}
+
+		const auto* head {this->src->data.c_str() + this->offset[nth]};
+
+		const auto* value {tape::find(this->value, nth)};
+
+		return token<A, B>
+		{
+			{
+				this->src->id,
+				this->offset[nth],
+				this->length[nth],
+			},
+			this->src,
+			this->type[nth],
+			{
+				head,
+				head + this->length[nth],
+			},
+			value ? *value : number {},
+		};
+	}
+
+private:
+
+	template
+	<
+		typename T
+	>
+	static constexpr auto find(const std::vector<std::pair<uint32_t, T>>& list, const uint32_t nth) -> const T*
+	{
+		const auto it
+		{
+			std::lower_bound
+			(
+				list.begin(),
+				list.end(),
+				nth,
+				[](const auto& lhs, const uint32_t rhs)
+				{
+					return lhs.first < rhs;
+				}
+			)
+		};
+		return it != list.end() && it->first == nth ? &it->second : nullptr;
+	}
+};
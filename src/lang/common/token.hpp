@@ -3,6 +3,7 @@
 #include <cassert>
 #include <cstdint>
 #include <utility>
+#include <variant>
 #include <iomanip>
 #include <iostream>
 
@@ -217,6 +218,9 @@ auto operator<<(std::ostream& os, const atom data) -> std::ostream&
 	}
 }
 
+// decoded literal; INT, BIN, OCT & HEX -> uint64_t, DEC -> double
+typedef std::variant<std::monostate, uint64_t, double> number;
+
 template
 <
 	model::text A,
@@ -232,19 +236,20 @@ struct token : public span
 	//|----------------|
 	atom type;
 	view data;
+	number value;
 
 public:
 
 	token
 	(
-		decltype(x) x,
-		decltype(y) y,
+		span pos,
 		decltype(src) src,
 		decltype(type) type,
-		decltype(data) data
+		decltype(data) data,
+		decltype(value) value = {}
 	)
 	:
-	span {x, y}, src {src}, type {type}, data {data} {}
+	span {pos}, src {src}, type {type}, data {data}, value {value} {}
 
 	//|-----------------|
 	//| member function |
@@ -266,6 +271,9 @@ public:
 
 	friend constexpr auto operator<<(std::ostream& os, const token& token) -> std::ostream&
 	{
+		// resolved on demand
+		const auto [line, column] {token.src->locate(token.offset)};
+
 		return
 		(
 			os
@@ -276,11 +284,11 @@ public:
 			<<
 			"("
 			<<
-			std::setfill('0') << std::setw(2) << token.y + 0
+			std::setfill('0') << std::setw(2) << line
 			<<
 			":"
 			<<
-			std::setfill('0') << std::setw(2) << token.x + 1
+			std::setfill('0') << std::setw(2) << column
 			<<
 			")"
 			<<
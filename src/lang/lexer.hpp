@@ -3,19 +3,24 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
+#include <vector>
 #include <variant>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
 
 #include "core/fs.hpp"
 
-#include "models/tst.hpp"
-
-#include "utils/unicode.hpp"
-#include "utils/ordering.hpp"
+#include "utils/simd.hpp"
+#include "utils/convert.hpp"
 
 #include "lang/common/eof.hpp"
 #include "lang/common/token.hpp"
 #include "lang/common/error.hpp"
-#include "lang/common/trail.hpp"
+#include "lang/common/tape.hpp"
+#include "lang/common/lexicon.hpp"
 
 template
 <
@@ -27,17 +32,31 @@ class lexer
 	//|-----<file>-----|
 	fs::file<A, B>* src;
 	//|----------------|
-	trail jar;
-	uint16_t x;
-	uint16_t y;
 	decltype(src->data.begin()) it;
 	decltype(&src->data.begin()) ptr {0};
 	decltype(*src->data.begin()) out {0};
 
+	//|---------------<unit>---------------|
+	typedef std::remove_cvref_t<decltype(*ptr)> unit;
+	//|------------------------------------|
+
+	//|--------------------------------------|
+	//| units read past the end of a token   |
+	//| at most. '@' of "@stati" tries every |
+	//| mark up to "@static", '1' of "1.5"   |
+	//| sees ".5", and the last code point   |
+	//| read may span more than one unit.    |
+	//|--------------------------------------|
+	static constexpr const uint32_t LOOKAHEAD
+	{
+		static_cast<uint32_t>(lexicon::reach - 1 < 2 ? 2 : lexicon::reach - 1)
+		+
+		static_cast<uint32_t>(sizeof(char32_t) / sizeof(unit) - 1)
+	};
+
 	#define T(value) token<A, B> \
 	{                            \
-	    this->x,                 \
-	    this->y,                 \
+	    this->here(),            \
 	    *this,                   \
 	    value,                   \
 	    {                        \
@@ -48,65 +67,88 @@ class lexer
 
 	#define E(value) error<A, B> \
 	{                            \
-	    this->x,                 \
-	    this->y,                 \
+	    this->here(),            \
 	    *this,                   \
 	    value,                   \
 	}                            \
 
+	// a unit that is a code point on its own
+	static constexpr auto is_plain(const char32_t code) -> bool
+	{
+		if constexpr (sizeof(unit) == 1)
+		{
+			return code < 0x80;
+		}
+		if constexpr (sizeof(unit) == 2)
+		{
+			return code < 0xD800 || 0xDFFF < code;
+		}
+		if constexpr (sizeof(unit) == 4)
+		{
+			return true;
+		}
+	}
+
 	inline constexpr auto next() -> char32_t
 	{
+		const auto* ptr {&this->it};
+
+		if (lexer::is_plain(*ptr)) [[likely]]
+		{
+			this->out = *ptr;
+			this->it = ptr + 1;
+
+			return this->out;
+		}
 		//|------------------|
 		this->out = *this->it;
 		//|------------------|
 		++this->it;
 
-		switch (this->out)
-		{
-			case '\n':
-			{
-				++this->jar.y();
-				break;
-			}
-			default:
-			{
-				++this->jar.x();
-				break;
-			}
-		}
 		return this->out;
 	}
 
 	inline constexpr auto back() -> char32_t
 	{
+		const auto* ptr {&this->it - 1};
+
+		if (lexer::is_plain(*ptr)) [[likely]]
+		{
+			this->out = *ptr;
+			this->it = ptr;
+
+			return this->out;
+		}
 		--this->it;
 		//|------------------|
 		this->out = *this->it;
 		//|------------------|
 
-		switch (this->out)
-		{
-			case '\n':
-			{
-				--this->jar.y();
-				break;
-			}
-			default:
-			{
-				--this->jar.x();
-				break;
-			}
-		}
 		return this->out;
 	}
 
+	// of the current token
+	inline constexpr auto here() const -> span
+	{
+		return
+		{
+			this->src->id,
+			static_cast<uint32_t>(this->ptr - this->src->data.c_str()),
+			static_cast<uint32_t>(&this->it - this->ptr),
+		};
+	}
+
 public:
 
 	lexer
 	(
 		decltype(src) file
 	)
-	: src {file}, it {file->data.begin()} {}
+	: src {file}, it {file->data.begin()}
+	{
+		// see span::offset
+		assert(file->data.size() <= UINT32_MAX);
+	}
 
 	//|-----------------|
 	//| member function |
@@ -121,86 +163,338 @@ public:
 	{
 		for
 		(
-			this->ptr = &this->it, this->x = this->jar.x(), this->y = this->jar.y()
+			this->ptr = &this->it
 			;
 			this->next()
 			;
-			this->ptr = &this->it, this->x = this->jar.x(), this->y = this->jar.y()
+			this->ptr = &this->it
 		)
 		{
-			switch (this->out)
+			if (0x80 <= this->out) [[unlikely]]
 			{
-				case '/':
+				if (lexicon::is_head(this->out))
+				{
+					return this->scan_word();
+				}
+				return E(u8"expects XID_Start");
+			}
+
+			const auto kind {lexicon::ascii[this->out]};
+
+			if (kind.space)
+			{
+				this->skip_blank();
+				continue;
+			}
+			if (kind.head)
+			{
+				return this->scan_word();
+			}
+			if (kind.digit)
+			{
+				if (this->out == '0')
+				{
+					switch (*this->it)
+					{
+						case 'b': { return this->scan_bin(); }
+						case 'o': { return this->scan_oct(); }
+						case 'x': { return this->scan_hex(); }
+					}
+				}
+				return this->scan_num();
+			}
+			if (kind.quote)
+			{
+				switch (this->out)
+				{
+					case '\'': { return this->scan_1_code(); }
+					case '\"': { return this->scan_N_code(); }
+				}
+			}
+			if (kind.mark)
+			{
+				if (this->out == '/')
 				{
 					switch (*this->it)
 					{
 						case '/': { this->skip_1_line_comment(); continue; }
 						case '*': { this->skip_N_line_comment(); continue; }
 					}
-					goto symbol;
 				}
-				case ' ':
-				case '\t':
-				case '\n':
+				return this->scan_mark();
+			}
+			return E(u8"expects XID_Start");
+		}
+		return eof {};
+	}
+
+	// all at once, as parallel arrays
+	inline constexpr auto tokenize_all() -> tape<A, B>
+	{
+		tape<A, B> out {this->src};
+
+		// ~1 token per 4 units is typical
+		out.reserve(this->src->data.size() / 4);
+
+		for (auto done {false}; !done;)
+		{
+			std::visit([&](auto&& arg)
+			{
+				typedef std::decay_t<decltype(arg)> T;
+
+				if constexpr (std::is_same_v<T, eof>)
 				{
-					continue;
+					done = true;
 				}
-				case '\'':
+				else
 				{
-					code:
-					return this->scan_1_code();
+					out.push(arg);
 				}
-				case '\"':
+			},
+			this->pull());
+		}
+		return out;
+	}
+
+	//|-----------------------------------------|
+	//| speculative parallel tokenization.      |
+	//|                                         |
+	//| the file is cut into chunks at line     |
+	//| starts, each lexed by a thread as if no |
+	//| string or comment spans the cut. then,  |
+	//| in order, a chunk is kept from the      |
+	//| first token that the previous one       |
+	//| really ends at; the lexer carries no    |
+	//| state between tokens, so from there on  |
+	//| both agree. if no such token exists,    |
+	//| the guess was wrong and only that chunk |
+	//| is lexed again, from the right place.   |
+	//|-----------------------------------------|
+
+	inline /*Ი︵𐑼*/ auto tokenize_all(const size_t jobs) -> tape<A, B>
+	{
+		const auto* data {this->src->data.c_str()};
+		const auto size {static_cast<uint32_t>(this->src->data.size())};
+
+		std::vector<uint32_t> cuts {static_cast<uint32_t>(&this->it - data)};
+
+		for (size_t i {1}; i < jobs; ++i)
+		{
+			const auto from {std::max<size_t>(cuts.back(), size * i / jobs)};
+
+			if (size <= from)
+			{
+				break;
+			}
+
+			const auto* ptr {utils::find_any(data + from, '\n', '\n')};
+
+			if (*ptr == '\0')
+			{
+				break;
+			}
+			cuts.emplace_back(ptr - data + 1);
+		}
+		cuts.emplace_back(size);
+
+		std::vector<std::pair<tape<A, B>, uint32_t>> parts;
+
+		parts.reserve(cuts.size() - 1);
+
+		for (size_t i {0}; i + 1 < cuts.size(); ++i)
+		{
+			parts.emplace_back(tape<A, B> {this->src}, 0);
+		}
+
+		// step 1. guess
+		{
+			std::vector<std::jthread> pool;
+
+			for (size_t i {1}; i < parts.size(); ++i)
+			{
+				pool.emplace_back([&, i]
+				{
+					parts[i] = this->scan(cuts[i], cuts[i + 1]);
+				});
+			}
+			parts[0] = this->scan(cuts[0], cuts[1]);
+		}
+
+		// step 2. stitch
+		tape<A, B> out {this->src};
+
+		uint32_t next {cuts[0]};
+
+		for (size_t i {0}; i < parts.size(); ++i)
+		{
+			if (cuts[i + 1] <= next)
+			{
+				continue; // swallowed
+			}
+
+			auto& [part, tail] {parts[i]};
+
+			const auto nth
+			{
+				std::lower_bound
+				(
+					part.offset.begin(),
+					part.offset.end(),
+					next
+				)
+				- part.offset.begin()
+			};
+
+			if (nth == part.size() || part.offset[nth] != next)
+			{
+				// wrong guess
+				parts[i] = this->scan(next, cuts[i + 1]);
+
+				out.append(part, 0);
+			}
+			else
+			{
+				out.append(part, nth);
+			}
+			next = tail;
+		}
+
+		// resume after the last token
+		this->it = data + size;
+
+		return out;
+	}
+
+	//|-----------------------------------------|
+	//| incremental re-lexing.                  |
+	//|                                         |
+	//| [head, tail) of the old buffer became   |
+	//| size units of this one. tokens whose    |
+	//| LOOKAHEAD units past their end lie all  |
+	//| before head are kept; lexing resumes    |
+	//| right after them, and stops as soon as  |
+	//| a token starts where an old one did,    |
+	//| past the edit. the rest is reused as    |
+	//| is, shifted by the change in length.    |
+	//|-----------------------------------------|
+
+	inline constexpr auto relex(const tape<A, B>& old, const uint32_t head, const uint32_t tail, const uint32_t size) -> tape<A, B>
+	{
+		const int64_t shift {static_cast<int64_t>(size) - (tail - head)};
+
+		// step 1. reuse; what the lexer peeked at must be before head, too
+		auto keep
+		{
+			std::lower_bound
+			(
+				old.offset.begin(),
+				old.offset.end(),
+				head
+			)
+			- old.offset.begin()
+		};
+		for (; 0 < keep && head < old.offset[keep - 1] + old.length[keep - 1] + LOOKAHEAD; --keep);
+
+		tape<A, B> out {this->src};
+
+		out.append(old, 0, keep);
+
+		this->it = this->src->data.c_str() + (keep ? old.offset[keep - 1] + old.length[keep - 1] : 0);
+
+		// step 2. re-lex until in sync
+		for (auto done {false}; !done;)
+		{
+			std::visit([&](auto&& arg)
+			{
+				typedef std::decay_t<decltype(arg)> T;
+
+				if constexpr (std::is_same_v<T, eof>)
 				{
-					text:
-					return this->scan_N_code();
+					done = true;
 				}
-				case '0':
+				else
 				{
-					switch (*this->it)
+					if (head + size <= arg.offset)
 					{
-						case 'b':
+						const auto nth
 						{
-							bin:
-							return this->scan_bin();
-						}
-						case 'o':
+							std::lower_bound
+							(
+								old.offset.begin(),
+								old.offset.end(),
+								arg.offset - shift
+							)
+							- old.offset.begin()
+						};
+
+						if (nth < old.size() && old.offset[nth] == arg.offset - shift)
 						{
-							oct:
-							return this->scan_oct();
-						}
-						case 'x':
-						{
-							hex:
-							return this->scan_hex();
+							out.append(old, nth, old.size(), shift);
+							// resume after the last token
+							this->it = this->src->data.c_str() + this->src->data.size();
+
+							done = true;
+							return;
 						}
 					}
-					[[fallthrough]];
+					out.push(arg);
 				}
-				case '1':
-				case '2':
-				case '3':
-				case '4':
-				case '5':
-				case '6':
-				case '7':
-				case '8':
-				case '9':
+			},
+			this->pull());
+		}
+		return out;
+	}
+
+private:
+
+	// tokens starting in [head, tail) & where the next one starts
+	inline constexpr auto scan(const uint32_t head, const uint32_t tail) -> std::pair<tape<A, B>, uint32_t>
+	{
+		lexer sub {this->src};
+
+		sub.it = this->src->data.c_str() + head;
+
+		tape<A, B> out {this->src};
+
+		// ~1 token per 4 units is typical
+		out.reserve((tail - head) / 4);
+
+		for (std::optional<uint32_t> next; true;)
+		{
+			std::visit([&](auto&& arg)
+			{
+				typedef std::decay_t<decltype(arg)> T;
+
+				if constexpr (std::is_same_v<T, eof>)
 				{
-					number:
-					return this->scan_num();
+					next = static_cast<uint32_t>(this->src->data.size());
 				}
-				default:
+				else if (tail <= arg.offset)
+				{
+					next = arg.offset;
+				}
+				else
 				{
-					symbol:
-					return this->scan_sym();
+					out.push(arg);
 				}
+			},
+			sub.pull());
+
+			if (next)
+			{
+				return {std::move(out), *next};
 			}
 		}
-		return eof {};
 	}
 
-private:
+	//|------------|
+	//| whitespace |
+	//|------------|
+
+	inline constexpr auto skip_blank()
+	{
+		this->it = utils::skip_blank(&this->it);
+	}
 
 	//|----------|
 	//| comments |
@@ -208,27 +502,30 @@ private:
 
 	inline constexpr auto skip_1_line_comment()
 	{
-		while (this->next())
+		this->it = utils::find_any(&this->it, '\n', '\n');
+
+		if (*this->it == '\n')
 		{
-			if (this->out == '\n')
-			{
-				// this->next();
-				break;
-			}
+			this->next();
 		}
 	}
 
 	inline constexpr auto skip_N_line_comment()
 	{
-		while (this->next())
+		// skip '*'
+		this->next();
+
+		for (auto ptr {&this->it}; true; ++ptr)
 		{
-			if (this->out == '*')
+			if (*(ptr = utils::find_any(ptr, '*', '*')) == '\0')
 			{
-				if (*this->it == '/')
-				{
-					this->next();
-					break;
-				}
+				this->it = ptr;
+				return;
+			}
+			if (ptr[1] == '/')
+			{
+				this->it = ptr + 2;
+				return;
 			}
 		}
 	}
@@ -243,17 +540,19 @@ private:
 
 		for (; this->next() && this->out != '\''; ++len)
 		{
-			if (this->out == '\\') { this->next(); }
+			if (this->out == '\\' && !this->next()) { break; }
 		}
 
-		if (len != 1)
-		{
-			return E(u8"code length must be 1");
-		}
 		if (!this->out)
 		{
+			// stay on the NUL
+			this->back();
 			return E(u8"incomplete code literal");
 		}
+		if (len != 1)
+		{
+			return E(u8"code length must be 1");
+		}
 		return T(atom::CODE);
 	}
 
@@ -263,11 +562,13 @@ private:
 		
 		for (; this->next() && this->out != '\"'; ++len)
 		{
-			if (this->out == '\\') { this->next(); }
+			if (this->out == '\\' && !this->next()) { break; }
 		}
 
 		if (!this->out)
 		{
+			// stay on the NUL
+			this->back();
 			return E(u8"incomplete string literal");
 		}
 		return T(atom::TEXT);
@@ -282,9 +583,10 @@ private:
 		// skip 'b'
 		this->next();
 
-		while (this->next())
+		while (true)
 		{
-			switch (this->out)
+			// '\0' -> default
+			switch (this->next())
 			{
 				// 0 ~ 1
 				case '0':
@@ -301,11 +603,12 @@ private:
 		}
 		bin_exit:
 
-		if (this->ptr - &this->it == 2)
+		// '0' & 'b' only
+		if (&this->it - this->ptr == 2)
 		{
 			return E(u8"incomplete bin literal");
 		}
-		return T(atom::BIN);
+		return this->decode(atom::BIN, 2);
 	}
 
 	inline constexpr auto scan_oct() -> decltype(this->pull())
@@ -313,9 +616,10 @@ private:
 		// skip 'o'
 		this->next();
 
-		while (this->next())
+		while (true)
 		{
-			switch (this->out)
+			// '\0' -> default
+			switch (this->next())
 			{
 				// 0 ~ 7
 				case '0':
@@ -338,11 +642,12 @@ private:
 		}
 		oct_exit:
 
-		if (this->ptr - &this->it == 2)
+		// '0' & 'o' only
+		if (&this->it - this->ptr == 2)
 		{
 			return E(u8"incomplete oct literal");
 		}
-		return T(atom::OCT);
+		return this->decode(atom::OCT, 8);
 	}
 
 	inline constexpr auto scan_hex() -> decltype(this->pull())
@@ -350,9 +655,10 @@ private:
 		// skip 'x'
 		this->next();
 
-		while (this->next())
+		while (true)
 		{
-			switch (this->out)
+			// '\0' -> default
+			switch (this->next())
 			{
 				// 0 ~ 9
 				case '0':
@@ -384,20 +690,22 @@ private:
 		}
 		hex_exit:
 
-		if (this->ptr - &this->it == 2)
+		// '0' & 'x' only
+		if (&this->it - this->ptr == 2)
 		{
 			return E(u8"incomplete hex literal");
 		}
-		return T(atom::HEX);
+		return this->decode(atom::HEX, 16);
 	}
 
 	inline constexpr auto scan_num() -> decltype(this->pull())
 	{
 		auto type {atom::INT};
 
-		while (this->next())
+		while (true)
 		{
-			switch (this->out)
+			// '\0' -> default
+			switch (this->next())
 			{
 				// 0 ~ 9
 				case '0':
@@ -450,81 +758,85 @@ private:
 		}
 		num_exit:
 
-		return T(type);
+		return this->decode(type, 10);
 	}
 
-	//|-----------|
-	//| TST magic |
-	//|-----------|
-
-	inline constexpr auto scan_sym() -> decltype(this->pull())
+	// decode once, here
+	inline constexpr auto decode(const atom type, const uint8_t radix) -> decltype(this->pull())
 	{
-		#define macro(K, V) { V, atom::K },
-		
-		static const tst<atom> TBL
-		{
-			delimeters(macro)
-			operators(macro)
-			keywords(macro)
-			special(macro)
-		};
-		#undef macro
+		auto out {T(type)};
 
-		auto view {TBL.view()};
+		if (type == atom::DEC)
+		{
+			if (const auto value {utils::parse_dec(this->ptr, &this->it)})
+			{
+				out.value = *value;
+				return out;
+			}
+			return E(u8"float literal out of range");
+		}
 
-		// counter
-		auto tkn_l {view[this->out] ? 1 : 0};
-		auto props {utils::props(this->out)};
-		auto sym_l {props.XID_Start ? 1 : 0};
+		// skip "0b", "0o" & "0x"
+		const auto* head {radix == 10 ? this->ptr : this->ptr + 2};
 
-		// infinite loop fix
-		if (tkn_l == 0 && sym_l == 0)
+		if (const auto value {utils::parse_int(head, &this->it, radix)})
 		{
-			return E(u8"expects XID_Start");
+			out.value = *value;
+			return out;
 		}
+		return E(u8"integer literal out of range");
+	}
+
+	//|---------------|
+	//| lexicon magic |
+	//|---------------|
 
-		// skip unnecessary iteration
-		if (!(sym_l == 0 && view.is_leaf()))
+	inline constexpr auto scan_word() -> decltype(this->pull())
+	{
+		while (true)
 		{
-			for (size_t i {1}; this->next(); ++i)
+			// ASCII, 16 bytes at a time
+			this->it = utils::skip_word(&this->it);
+
+			if (*&this->it < 0x80)
 			{
-				props = utils::props(this->out);
-				
-				// token check
-				if (tkn_l == i && view[this->out])
-				{
-					++tkn_l;
-				}
-				// symbol check
-				if (sym_l == i && props.XID_Continue)
-				{
-					++sym_l;
-				}
-				// if both fails
-				if (tkn_l != i + 1 && sym_l != i + 1)
-				{
-					this->back();
-					break;
-				}
+				break;
+			}
+			// non-ASCII
+			if (!lexicon::is_body(this->next()))
+			{
+				// undo
+				this->back();
+				break;
 			}
 		}
 
-		switch (utils::cmp(tkn_l, sym_l))
+		// let! & fun!
+		if (*this->it == '!')
 		{
-			case utils::ordering::LESS:
-			{
-				return T(atom::SYMBOL); // <- always symbol
-			}
-			case utils::ordering::EQUAL:
+			if (auto type {lexicon::words[typename B::slice {this->ptr, &this->it + 1}]})
 			{
-				return T(view.value().value_or(atom::SYMBOL));
+				this->next();
+				return T(*type);
 			}
-			case utils::ordering::GREATER:
+		}
+		const auto type {lexicon::words[typename B::slice {this->ptr, &this->it}]};
+
+		return T(type.value_or(atom::SYMBOL));
+	}
+
+	inline constexpr auto scan_mark() -> decltype(this->pull())
+	{
+		// maximal munch, from the first code point
+		if (const auto match {lexicon::marks.longest_match(decltype(this->it) {this->ptr})})
+		{
+			for (auto len {match->first}; 1 < len; --len)
 			{
-				return T(*view.value()); // <- always deref
+				this->next();
 			}
+			return T(match->second);
 		}
-		assert(false && "-Wreturn-type");
+		return E(u8"expects XID_Start");
 	}
 
 	#undef T
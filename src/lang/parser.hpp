@@ -1,19 +1,25 @@
 #pragma once
 
 #include <array>
-#include <memory>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include <cassert>
 #include <cstdint>
 #include <variant>
 #include <utility>
 #include <optional>
 #include <iostream>
+#include <algorithm>
 #include <type_traits>
 
 #include "./lexer.hpp"
 
+#include "core/trace.hpp"
+
 #include "lang/common/ast.hpp"
 #include "lang/common/eof.hpp"
+#include "lang/common/tape.hpp"
 #include "lang/common/token.hpp"
 #include "lang/common/error.hpp"
 
@@ -24,21 +30,35 @@ template
 >
 class parser
 {
-	lexer<A, B>* lexer;
+	lexer<A, B>* lexer {nullptr};
+	// by index, if any
+	const tape<A, B>* tape {nullptr};
+	uint32_t nth {0};
+	uint32_t end {UINT32_MAX};
+	// skip fun bodies
+	bool lazy {false};
+	// a recovery ran out of tokens
+	bool spent {false};
 
 	#define E(value) error<A, B> \
 	{                            \
-	    this->x,                 \
-	    this->y,                 \
+	    this->pos,               \
 	    *this,                   \
 	    value,                   \
 	}                            \
 	
-	uint16_t x {0};
-	uint16_t y {0};
+	#define TRACE                                  \
+	static const auto rule {trace::rule(__func__)}; \
+	const trace::scope _ {rule, this->pos}          \
+
+	span pos {};
 
 	AST<A, B> exe;
 
+	//|-----------<fault>-----------|
+	std::optional<error<A, B>> fail;
+	//|-----------------------------|
+
 	//|---------<buffer>---------|
 	decltype(lexer->pull()) buffer;
 	//|--------------------------|
@@ -47,6 +67,19 @@ class parser
 	typedef std::optional<token<A, B>> maybe;
 	//|------------------------------------|
 
+	inline constexpr auto fetch() -> decltype(this->buffer)
+	{
+		if (this->tape)
+		{
+			if (this->nth < this->end)
+			{
+				return (*this->tape)[this->nth++];
+			}
+			return eof {};
+		}
+		return this->lexer->pull();
+	}
+
 	inline constexpr auto peek() -> maybe
 	{
 		return std::visit([&](auto&& arg) -> maybe
@@ -59,7 +92,7 @@ class parser
 			}
 			if constexpr (std::is_same_v<T, error<A, B>>)
 			{
-				throw arg;
+				return this->raise(arg);
 			}
 			return std::nullopt;
 		},
@@ -69,20 +102,17 @@ class parser
 	inline constexpr auto next() -> maybe
 	{
 		// step 1. update buffer
-		this->buffer = this->lexer->pull();
+		this->buffer = this->fetch();
 
-		// step 2. update x & y position
+		// step 2. update position
 		return std::visit([&](auto&& arg) -> maybe
 		{
 			typedef std::decay_t<decltype(arg)> T;
 
 			if constexpr (!std::is_same_v<T, eof>)
 			{
-				#ifndef NDEBUG //-------|
-				std::cout << arg << '\n';
-				#endif //---------------|
-				this->x = arg.x;
-				this->y = arg.y;
+				trace::read(arg);
+				this->pos = arg;
 			}
 			return this->peek();
 		},
@@ -101,7 +131,7 @@ class parser
 			}
 			if constexpr (std::is_same_v<T, error<A, B>>)
 			{
-				throw arg; // rawr!
+				this->raise(arg); // rawr!
 			}
 			return false;
 		},
@@ -111,20 +141,17 @@ class parser
 	inline constexpr auto next(const atom type) -> bool
 	{
 		// step 1. update buffer
-		this->buffer = this->lexer->pull();
+		this->buffer = this->fetch();
 
-		// step 2. update x & y position
+		// step 2. update position
 		return std::visit([&](auto&& arg) -> bool
 		{
 			typedef std::decay_t<decltype(arg)> T;
 
 			if constexpr (!std::is_same_v<T, eof>)
 			{
-				#ifndef NDEBUG //-------|
-				std::cout << arg << '\n';
-				#endif //---------------|
-				this->x = arg.x;
-				this->y = arg.y;
+				trace::read(arg);
+				this->pos = arg;
 			}
 			return this->peek(type);
 		},
@@ -137,7 +164,7 @@ public:
 	(
 		decltype(lexer) lexer
 	)
-	: lexer {lexer}, buffer {this->lexer->pull()}
+	: lexer {lexer}, buffer {this->fetch()}
 	{
 		std::visit([&](auto&& arg)
 		{
@@ -145,11 +172,75 @@ public:
 
 			if constexpr (!std::is_same_v<T, eof>)
 			{
-				#ifndef NDEBUG //-------|
-				std::cout << arg << '\n';
-				#endif //---------------|
-				this->x = arg.x;
-				this->y = arg.y;
+				trace::read(arg);
+				this->pos = arg;
+			}
+		},
+		this->buffer);
+	}
+
+	//|-------------------------------------------|
+	//| lazy fun bodies.                          |
+	//|                                           |
+	//| with lazy set, decl_fun keeps the name,   |
+	//| args & type, notes the tokens of its body |
+	//| & skips to the matching '}'. the body is  |
+	//| parsed on AST::wake, into the same pool,  |
+	//| and so are its diagnostics; the tape must |
+	//| outlive the AST until then. a body that   |
+	//| fails is reported & left empty, and what  |
+	//| remains of it up to its '}' is skipped;   |
+	//| wake then says false, for the caller to   |
+	//| drop the fun as eager parsing would.      |
+	//|-------------------------------------------|
+
+	parser
+	(
+		decltype(tape) tape,
+		const bool lazy = false
+	)
+	: tape {tape}, lazy {lazy}, buffer {this->fetch()}
+	{
+		if (lazy)
+		{
+			this->exe.wake = [tape](AST<A, B>& exe, fun_decl* fun) -> bool
+			{
+				if (fun->lazy[0] == fun->lazy[1])
+				{
+					return true;
+				}
+				parser sub {tape, true};
+
+				sub.seek(fun->lazy[0], fun->lazy[1]);
+
+				fun->lazy[0] = fun->lazy[1] = 0;
+
+				const auto fine {sub.fun_body(fun).has_value()};
+
+				if (!fine)
+				{
+					// eager parsing keeps no part of it
+					fun->body = {};
+					// unless fallout
+					sub.recover();
+				}
+				for (const auto& lint : sub.exe.lint)
+				{
+					exe.lint.emplace_back(lint);
+				}
+				exe.pool.merge(std::move(sub.exe.pool));
+
+				return fine;
+			};
+		}
+		std::visit([&](auto&& arg)
+		{
+			typedef std::decay_t<decltype(arg)> T;
+
+			if constexpr (!std::is_same_v<T, eof>)
+			{
+				trace::read(arg);
+				this->pos = arg;
 			}
 		},
 		this->buffer);
@@ -161,53 +252,565 @@ public:
 	
 	operator fs::file<A, B>*()
 	{
+		if (this->tape)
+		{
+			return this->tape->src;
+		}
 		return *this->lexer;
 	}
 
 	inline constexpr auto pull() -> AST<A, B>
 	{
-		while (this->peek())
+		this->parse();
+
+		return std::move(this->exe);
+	}
+
+	//|-------------------------------------------|
+	//| parallel parsing of top-level decls.      |
+	//|                                           |
+	//| a pre-pass over the tape cuts it before   |
+	//| each fun/model/trait at brace depth 0 &   |
+	//| after the '}' that closes it; whatever is |
+	//| in between is a chunk of its own. chunks  |
+	//| are handed out to `jobs` parsers, each    |
+	//| with an arena of its own, and stitched in |
+	//| source order, so are the diagnostics. an  |
+	//| error is recovered from within its chunk. |
+	//|-------------------------------------------|
+
+	inline /*Ი︵𐑼*/ auto pull(const size_t jobs) -> AST<A, B>
+	{
+		if (this->tape == nullptr || jobs < 2)
+		{
+			return this->pull();
+		}
+
+		// step 1. cut
+		const auto cuts {this->split()};
+
+		struct part
 		{
-			try
+			// by worker
+			size_t by;
+			// [head, tail) of its AST
+			size_t body[2];
+			size_t lint[2];
+		};
+
+		std::vector<part> parts(cuts.size() - 1);
+
+		std::vector<parser> subs;
+
+		subs.reserve(jobs);
+
+		for (size_t i {0}; i < jobs; ++i)
+		{
+			subs.emplace_back(this->tape, this->lazy);
+		}
+
+		// step 2. parse
+		{
+			std::atomic<size_t> next {0};
+
+			const auto work {[&](const size_t by)
 			{
-				if (auto out {this->_decl()})
+				auto& sub {subs[by]};
+
+				for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < parts.size();)
 				{
-					std::visit([&](auto&& ptr)
-					{
-						this->exe.body.emplace_back(std::forward<decltype(ptr)>(ptr));
-					},
-					std::move(*out)); // unwrap
-					continue;
+					auto& out {parts[i]};
+
+					out.by = by;
+					out.body[0] = sub.exe.body.size();
+					out.lint[0] = sub.exe.lint.size();
+
+					sub.seek(cuts[i], cuts[i + 1]);
+					sub.parse();
+
+					out.body[1] = sub.exe.body.size();
+					out.lint[1] = sub.exe.lint.size();
+				}
+			}};
+
+			std::vector<std::jthread> pool;
+
+			for (size_t i {1}; i < jobs; ++i)
+			{
+				pool.emplace_back(work, i);
+			}
+			work(0);
+		}
+
+		// step 3. stitch
+		for (const auto& [by, body, lint] : parts)
+		{
+			const auto& sub {subs[by].exe};
+
+			for (auto i {body[0]}; i < body[1]; ++i)
+			{
+				this->exe.body.emplace_back(this->exe.pool, sub.body[i]);
+			}
+			for (auto i {lint[0]}; i < lint[1]; ++i)
+			{
+				this->exe.lint.emplace_back(sub.lint[i]);
+			}
+		}
+		for (auto& sub : subs)
+		{
+			this->exe.pool.merge(std::move(sub.exe.pool));
+		}
+		return std::move(this->exe);
+	}
+
+	//|-------------------------------------------|
+	//| incremental re-parsing.                   |
+	//|                                           |
+	//| [head, tail) of prev's buffer became size |
+	//| units of this tape's, as in lexer::relex. |
+	//| both tapes are cut as in pull(jobs); a    |
+	//| chunk whose tokens lie wholly before or   |
+	//| after the edit, and match the old ones,   |
+	//| keeps the old subtrees, moved to the new  |
+	//| file & shifted. the rest is parsed again. |
+	//| chunks that had diagnostics, or that the  |
+	//| old parse did not start on, never reuse.  |
+	//|-------------------------------------------|
+
+	inline /*Ი︵𐑼*/ auto pull(AST<A, B>&& old, const ::tape<A, B>& prev, const uint32_t head, const uint32_t tail, const uint32_t size) -> AST<A, B>
+	{
+		assert(this->tape);
+
+		const int64_t shift {static_cast<int64_t>(size) - (tail - head)};
+
+		// step 1. cut
+		const auto cuts {this->split()};
+		const auto olds {parser {&prev}.split()};
+
+		const auto offset {[](const auto& node) -> uint32_t
+		{
+			return std::visit([](const auto* ptr) { return ptr->offset; }, node);
+		}};
+
+		struct part
+		{
+			// [head, tail) of old.body
+			size_t body[2];
+			// no diagnostics
+			bool clean;
+		};
+
+		std::vector<part> parts(olds.size() - 1, {{0, 0}, true});
+
+		// by first token, as every node starts at one
+		const auto which {[&](const uint32_t offset) -> size_t
+		{
+			size_t lo {0};
+			size_t hi {parts.size()};
+
+			while (lo + 1 < hi)
+			{
+				const auto mid {(lo + hi) / 2};
+
+				(prev.offset[olds[mid]] <= offset ? lo : hi) = mid;
+			}
+			return lo;
+		}};
+
+		if (!parts.empty())
+		{
+			for (size_t i {0}; i < old.body.size(); ++i)
+			{
+				auto& out {parts[which(offset(old.body[i]))]};
+
+				out.body[0] = out.body[1] == 0 ? i : out.body[0];
+				out.body[1] = i + 1;
+			}
+			for (const auto& lint : old.lint)
+			{
+				parts[which(lint.offset)].clean = false;
+			}
+		}
+
+		// step 2. reuse or re-parse, in order
+		for (size_t j {0}; j + 1 < cuts.size(); ++j)
+		{
+			const auto c {cuts[j]};
+			const auto d {cuts[j + 1]};
+
+			const auto& now {*this->tape};
+
+			// where the chunk was, if untouched
+			std::optional<std::pair<uint32_t, int64_t>> was;
+
+			if (now.offset[d - 1] + now.length[d - 1] < head)
+			{
+				was = {c, 0};
+			}
+			else if (head + size <= now.offset[c])
+			{
+				was = {static_cast<uint32_t>(c - (static_cast<int64_t>(now.size()) - prev.size())), shift};
+			}
+
+			const auto reuse {[&]() -> const part*
+			{
+				if (!was)
+				{
+					return nullptr;
 				}
-				if (auto out {this->_stmt()})
+				const auto [a, delta] {*was};
+
+				const auto it {std::ranges::lower_bound(olds, a)};
+
+				if (it == olds.end() || *it != a || it + 1 == olds.end() || *(it + 1) != a + (d - c))
 				{
-					std::visit([&](auto&& ptr)
+					return nullptr;
+				}
+				for (uint32_t k {0}; k < d - c; ++k)
+				{
+					if
+					(
+						now.type[c + k] != prev.type[a + k]
+						||
+						now.length[c + k] != prev.length[a + k]
+						||
+						now.offset[c + k] != prev.offset[a + k] + delta
+					)
 					{
-						this->exe.body.emplace_back(std::forward<decltype(ptr)>(ptr));
-					},
-					std::move(*out)); // unwrap
-					continue;
+						return nullptr;
+					}
+				}
+				const auto& out {parts[it - olds.begin()]};
+
+				if (!out.clean || out.body[0] == out.body[1] || offset(old.body[out.body[0]]) != prev.offset[a])
+				{
+					return nullptr;
 				}
-				throw E(u8"unknown decl/stmt");
+				return &out;
 			}
-			catch (error<A, B>& out)
+			()};
+
+			if (reuse)
 			{
-				// recovery
-				this->sync();
-				// diagnostics
-				this->exe.lint
-				.emplace_back(out);
+				// # of tokens it moved by
+				const int64_t moved {static_cast<int64_t>(c) - was->first};
+
+				for (auto i {reuse->body[0]}; i < reuse->body[1]; ++i)
+				{
+					if (was->second != 0 || moved != 0 || prev.src->id != now.src->id)
+					{
+						this->rebase(old.body[i], now.src->id, was->second, moved);
+					}
+					this->exe.body.emplace_back(this->exe.pool, old.body[i]);
+				}
+				continue;
 			}
+			this->seek(c, d);
+			this->parse();
 		}
+		this->exe.pool.merge(std::move(old.pool));
+
 		return std::move(this->exe);
 	}
 
 private:
 
+	template
+	<
+		typename T
+	>
+	// owned by the AST
+	inline /*Ი︵𐑼*/ auto make() -> T*
+	{
+		return this->exe.pool.template make<T>();
+	}
+
+	// owned by the AST, as UTF-8
+	inline /*Ი︵𐑼*/ auto word(const typename B::slice& str) -> utf8::slice
+	{
+		if constexpr (std::is_same_v<B, utf8>)
+		{
+			auto* ptr {this->exe.pool.template array<char8_t>(str.size())};
+
+			std::ranges::copy(&str.begin(), &str.end(), ptr);
+
+			return {ptr, ptr + str.size()};
+		}
+		else
+		{
+			const utf8 tmp {str};
+
+			auto* ptr {this->exe.pool.template array<char8_t>(tmp.size())};
+
+			std::ranges::copy(tmp.c_str(), tmp.c_str() + tmp.size(), ptr);
+
+			return {ptr, ptr + tmp.size()};
+		}
+	}
+
+	// until eof, into this->exe
+	inline constexpr auto parse()
+	{
+		while (this->peek() || this->fail)
+		{
+			if (auto out {this->_decl()})
+			{
+				std::visit([&](auto&& ptr)
+				{
+					this->exe.body.emplace_back(this->exe.pool, std::forward<decltype(ptr)>(ptr));
+				},
+				std::move(*out)); // unwrap
+				continue;
+			}
+			if (auto out {this->_stmt()})
+			{
+				std::visit([&](auto&& ptr)
+				{
+					this->exe.body.emplace_back(this->exe.pool, std::forward<decltype(ptr)>(ptr));
+				},
+				std::move(*out)); // unwrap
+				continue;
+			}
+			this->raise(E(u8"unknown decl/stmt"));
+			// recovery
+			this->recover();
+		}
+	}
+
+	// [head, tail) of the tape, from now on
+	inline constexpr auto seek(const uint32_t head, const uint32_t tail)
+	{
+		this->nth = head;
+		this->end = tail;
+
+		this->fail.reset();
+		this->spent = false;
+
+		this->buffer = this->fetch();
+
+		std::visit([&](auto&& arg)
+		{
+			typedef std::decay_t<decltype(arg)> T;
+
+			if constexpr (!std::is_same_v<T, eof>)
+			{
+				trace::read(arg);
+				this->pos = arg;
+			}
+		},
+		this->buffer);
+	}
+
+	// chunk boundaries of the tape, from the current token on
+	inline constexpr auto split() const -> std::vector<uint32_t>
+	{
+		const auto size {static_cast<uint32_t>(std::min<size_t>(this->tape->size(), this->end))};
+
+		std::vector<uint32_t> out {std::min(this->nth - 1, size)};
+
+		size_t depth {0};
+
+		for (auto i {out.back()}; i < size; ++i)
+		{
+			switch (this->tape->type[i])
+			{
+				case atom::FUN:
+				case atom::FUN_:
+				case atom::MODEL:
+				case atom::TRAIT:
+				{
+					if (depth == 0 && out.back() != i)
+					{
+						out.emplace_back(i);
+					}
+					break;
+				}
+				case atom::L_BRACE:
+				{
+					++depth;
+					break;
+				}
+				case atom::R_BRACE:
+				{
+					if (depth != 0 && --depth == 0)
+					{
+						out.emplace_back(i + 1);
+					}
+					break;
+				}
+			}
+		}
+		if (out.back() != size)
+		{
+			out.emplace_back(size);
+		}
+		return out;
+	}
+
+	// moves a subtree to file, shifted by shift units & moved tokens
+	inline /*Ი︵𐑼*/ auto rebase(const auto& node, const uint32_t file, const int64_t shift, const int64_t moved) -> void
+	{
+		if constexpr (!std::is_pointer_v<std::remove_cvref_t<decltype(node)>>)
+		{
+			std::visit([&](auto* ptr)
+			{
+				if (ptr)
+				{
+					this->rebase(ptr, file, shift, moved);
+				}
+			},
+			node);
+		}
+		else
+		{
+			typedef std::remove_cvref_t<decltype(*node)> T;
+
+			node->file = file;
+			node->offset += shift;
+
+			if constexpr (std::is_same_v<T, var_decl>)
+			{
+				if (node->init)
+				{
+					this->rebase(*node->init, file, shift, moved);
+				}
+			}
+			if constexpr (std::is_same_v<T, fun_decl>)
+			{
+				if (node->lazy[0] != node->lazy[1])
+				{
+					node->lazy[0] += moved;
+					node->lazy[1] += moved;
+				}
+			}
+			if constexpr (std::is_same_v<T, fun_decl> || std::is_same_v<T, block_stmt>)
+			{
+				for (const auto& it : node->body)
+				{
+					this->rebase(it, file, shift, moved);
+				}
+			}
+			if constexpr (std::is_same_v<T, trait_decl>)
+			{
+				for (const auto& data : node->body)
+				{
+					for (const auto& it : data.body)
+					{
+						this->rebase(it, file, shift, moved);
+					}
+				}
+			}
+			if constexpr (std::is_same_v<T, if_stmt> || std::is_same_v<T, match_stmt>)
+			{
+				if constexpr (std::is_same_v<T, match_stmt>)
+				{
+					this->rebase(node->data, file, shift, moved);
+				}
+				for (const auto& flow : node->body)
+				{
+					this->rebase(flow._if_, file, shift, moved);
+					this->rebase(flow.then, file, shift, moved);
+				}
+			}
+			if constexpr (std::is_same_v<T, for_stmt>)
+			{
+				this->rebase(node->init, file, shift, moved);
+				this->rebase(node->_if_, file, shift, moved);
+				this->rebase(node->task, file, shift, moved);
+				this->rebase(node->body, file, shift, moved);
+			}
+			if constexpr (std::is_same_v<T, while_stmt>)
+			{
+				this->rebase(node->_if_, file, shift, moved);
+				this->rebase(node->body, file, shift, moved);
+			}
+			if constexpr (std::is_same_v<T, return_stmt>)
+			{
+				this->rebase(node->value, file, shift, moved);
+			}
+			if constexpr (std::is_same_v<T, prefix_expr>)
+			{
+				this->rebase(node->rhs, file, shift, moved);
+			}
+			if constexpr (std::is_same_v<T, binary_expr>)
+			{
+				this->rebase(node->lhs, file, shift, moved);
+				this->rebase(node->rhs, file, shift, moved);
+			}
+			if constexpr (std::is_same_v<T, suffix_expr> || std::is_same_v<T, access_expr>)
+			{
+				this->rebase(node->lhs, file, shift, moved);
+			}
+			if constexpr (std::is_same_v<T, invoke_expr>)
+			{
+				this->rebase(node->lhs, file, shift, moved);
+
+				for (const auto& it : node->args)
+				{
+					this->rebase(it, file, shift, moved);
+				}
+			}
+			if constexpr (std::is_same_v<T, group_expr>)
+			{
+				this->rebase(node->self, file, shift, moved);
+			}
+		}
+	}
+
+	inline /*Ი︵𐑼*/ auto report(const error<A, B>& out)
+	{
+		if (trace::enabled()) [[unlikely]]
+		{
+			trace::read(out);
+			trace::dump<atom>();
+		}
+	}
+
+	//|-------------------------------------------|
+	//| errors travel by value, not by unwinding. |
+	//|                                           |
+	//| raise() keeps the first error and makes   |
+	//| the rule give up; each rule then returns  |
+	//| at once, up to the nearest _decl, _stmt,  |
+	//| _expr or pull(), which calls recover().   |
+	//| those refuse to start while an error is   |
+	//| pending, as a catch block only sees what  |
+	//| was thrown inside of its try block. once  |
+	//| a recovery runs out of tokens, what fails |
+	//| after it is fallout & goes unreported.    |
+	//|-------------------------------------------|
+
+	inline constexpr auto raise(const error<A, B>& out) -> std::nullopt_t
+	{
+		if (!this->fail)
+		{
+			this->fail.emplace(out);
+		}
+		return std::nullopt;
+	}
+
+	inline constexpr auto recover()
+	{
+		if (!this->spent)
+		{
+			// diagnostics
+			this->exe.lint
+			.emplace_back(*this->fail);
+			// post-mortem
+			this->report(*this->fail);
+		}
+		// recovery
+		this->sync();
+		// e.g. a '}' or ';' that sync() ate
+		this->spent = std::holds_alternative<eof>(this->buffer);
+		// handled
+		this->fail.reset();
+	}
+
 	inline constexpr auto sync()
 	{
 		start:
-		if (auto tkn {this->peek()})
+		if (auto tkn {std::get_if<token<A, B>>(&this->buffer)})
 		{
 			switch (tkn->type)
 			{
@@ -226,63 +829,83 @@ private:
 				}
 			}
 		}
+		if (auto err {std::get_if<error<A, B>>(&this->buffer)})
+		{
+			// skipped, yet reported
+			if (err->offset != this->fail->offset)
+			{
+				this->exe.lint
+				.emplace_back(*err);
+			}
+			this->next();
+			goto start;
+		}
 		close:
 		return;
 	}
 
 	inline constexpr auto _decl() -> std::optional<decl>
 	{
-		try
+		TRACE;
+
+		if (this->fail)
 		{
-			if (auto tkn {this->peek()})
+			return std::nullopt;
+		}
+
+		while (true)
+		{
+			auto out {[&]() -> std::optional<decl>
 			{
-				switch (tkn->type)
+				if (auto tkn {this->peek()})
 				{
-					case atom::LET:
-					{
-						return this->decl_var(false);
-					}
-					case atom::LET_:
+					switch (tkn->type)
 					{
-						return this->decl_var(true);
-					}
-					case atom::FUN:
-					{
-						return this->decl_fun(false);
-					}
-					case atom::FUN_:
-					{
-						return this->decl_fun(true);
-					}
-					case atom::MODEL:
-					{
-						return this->decl_model();
-					}
-					case atom::TRAIT:
-					{
-						return this->decl_trait();
+						case atom::LET:
+						{
+							return this->decl_var(false);
+						}
+						case atom::LET_:
+						{
+							return this->decl_var(true);
+						}
+						case atom::FUN:
+						{
+							return this->decl_fun(false);
+						}
+						case atom::FUN_:
+						{
+							return this->decl_fun(true);
+						}
+						case atom::MODEL:
+						{
+							return this->decl_model();
+						}
+						case atom::TRAIT:
+						{
+							return this->decl_trait();
+						}
 					}
 				}
+				return std::nullopt;
 			}
-			return std::nullopt;
-		}
-		catch (error<A, B>& out)
-		{
-			// recovery
-			this->sync();
-			// diagnostics
-			this->exe.lint
-			.emplace_back(out);
+			()};
+
+			if (!this->fail) [[likely]]
+			{
+				return out;
+			}
+			this->recover();
 		}
-		return this->_decl();
 	}
 
-	inline constexpr auto decl_var(const bool only) -> decl
+	inline constexpr auto decl_var(const bool only) -> std::optional<decl>
 	{
-		auto ast {std::make_unique<var_decl>()};
+		TRACE;
+
+		auto ast {this->make<var_decl>()};
 		
-		ast->x = this->x;
-		ast->y = this->y;
+		static_cast<span&>(*ast) = this->pos;
 
 		this->next();
 
@@ -290,27 +913,27 @@ private:
 
 		if (this->peek(atom::SYMBOL))
 		{
-			ast->name = // move
-			this->peek()->data;
+			ast->name = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 		}
-		else throw E(u8"expects 'ƒ'");
+		else return this->raise(E(u8"expects 'ƒ'"));
 
 		if (this->peek(atom::COLON))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ':'");
+		else return this->raise(E(u8"expects ':'"));
 
 		if (this->peek(atom::SYMBOL))
 		{
-			ast->type = // move
-			this->peek()->data;
+			ast->type = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 		}
-		else throw E(u8"expects 'ƒ'");
+		else return this->raise(E(u8"expects 'ƒ'"));
 
 		if (this->peek(atom::ASSIGN))
 		{
@@ -320,7 +943,7 @@ private:
 			{
 				ast->init = std::move(out);
 			}
-			else throw E(u8"invalid expr");
+			else return this->raise(E(u8"invalid expr"));
 		}
 		// else throw u8"must init";
 
@@ -328,17 +951,18 @@ private:
 		{
 			this->next();
 		}
-		else throw E(u8"expects ';'");
+		else return this->raise(E(u8"expects ';'"));
 
 		return ast;
 	}
 
-	inline constexpr auto decl_fun(const bool pure) -> decl
+	inline constexpr auto decl_fun(const bool pure) -> std::optional<decl>
 	{
-		auto ast {std::make_unique<fun_decl>()};
+		TRACE;
 
-		ast->x = this->x;
-		ast->y = this->y;
+		auto ast {this->make<fun_decl>()};
+
+		static_cast<span&>(*ast) = this->pos;
 		
 		this->next();
 
@@ -346,18 +970,18 @@ private:
 
 		if (this->peek(atom::SYMBOL))
 		{
-			ast->name = // move
-			this->peek()->data;
+			ast->name = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 		}
-		else throw E(u8"expects 'ƒ'");
+		else return this->raise(E(u8"expects 'ƒ'"));
 	
 		if (this->peek(atom::L_PAREN))
 		{
 			this->next();
 		}
-		else throw E(u8"expects '('");
+		else return this->raise(E(u8"expects '('"));
 
 		_start_:
 		// fresh construct
@@ -365,8 +989,8 @@ private:
 
 		if (this->peek(atom::SYMBOL))
 		{
-			data.name = // move
-			this->peek()->data;
+			data.name = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 
@@ -374,18 +998,18 @@ private:
 			{
 				this->next();
 			}
-			else throw E(u8"expects ':'");
+			else return this->raise(E(u8"expects ':'"));
 
 			if (this->peek(atom::SYMBOL))
 			{
-				data.type = // move
-				this->peek()->data;
+				data.type = // copy
+				this->word(this->peek()->data);
 
 				this->next();
 			}
-			else throw E(u8"expects 'ƒ'");
+			else return this->raise(E(u8"expects 'ƒ'"));
 
-			ast->args.emplace_back(data);
+			ast->args.emplace_back(this->exe.pool, data);
 			
 			if (this->peek(atom::COMMA))
 			{
@@ -393,42 +1017,81 @@ private:
 				goto _start_;
 			}
 		}
-		// else throw E(u8"expects 'ƒ'");
+		// else return this->raise(E(u8"expects 'ƒ'"));
 
 		if (this->peek(atom::R_PAREN))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ')'");
+		else return this->raise(E(u8"expects ')'"));
 
 		if (this->peek(atom::COLON))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ':'");
+		else return this->raise(E(u8"expects ':'"));
 
 		if (this->peek(atom::SYMBOL))
 		{
-			ast->type = // move
-			this->peek()->data;
+			ast->type = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 		}
-		else throw E(u8"expects 'ƒ'");
+		else return this->raise(E(u8"expects 'ƒ'"));
 
 		if (this->peek(atom::L_BRACE))
 		{
 			this->next();
 		}
-		else throw E(u8"expects '{'");
+		else return this->raise(E(u8"expects '{'"));
+
+		if (this->lazy && !this->fail)
+		{
+			const auto size {static_cast<uint32_t>(std::min<size_t>(this->tape->size(), this->end))};
+
+			size_t depth {1};
+
+			// the matching '}', if any
+			for (auto i {this->nth - 1}; i < size; ++i)
+			{
+				switch (this->tape->type[i])
+				{
+					case atom::L_BRACE:
+					{
+						++depth;
+						break;
+					}
+					case atom::R_BRACE:
+					{
+						if (--depth == 0)
+						{
+							ast->lazy[0] = this->nth - 1;
+							ast->lazy[1] = i + 1;
+
+							this->seek(i + 1, this->end);
+
+							return ast;
+						}
+						break;
+					}
+				}
+			}
+			// unbalanced; parse it now
+		}
+		return this->fun_body(ast);
+	}
 
+	// from after the '{' of a fun, up to & past its '}'
+	inline constexpr auto fun_body(fun_decl* ast) -> std::optional<decl>
+	{
 		while (true)
 		{
 			if (auto out {this->_decl()})
 			{
 				std::visit([&](auto&& ptr)
 				{
-					ast->body.emplace_back(std::forward<decltype(ptr)>(ptr));
+					ast->body.emplace_back(this->exe.pool, std::forward<decltype(ptr)>(ptr));
 				},
 				std::move(*out)); // unwrap
 				continue;
@@ -437,7 +1100,7 @@ private:
 			{
 				std::visit([&](auto&& ptr)
 				{
-					ast->body.emplace_back(std::forward<decltype(ptr)>(ptr));
+					ast->body.emplace_back(this->exe.pool, std::forward<decltype(ptr)>(ptr));
 				},
 				std::move(*out)); // unwrap
 				continue;
@@ -448,11 +1111,11 @@ private:
 				{
 					this->next();
 				}
-				else throw E(u8"expects ';'");
+				else return this->raise(E(u8"expects ';'"));
 
 				std::visit([&](auto&& ptr)
 				{
-					ast->body.emplace_back(std::forward<decltype(ptr)>(ptr));
+					ast->body.emplace_back(this->exe.pool, std::forward<decltype(ptr)>(ptr));
 				},
 				std::move(*out)); // unwrap
 				continue;
@@ -464,34 +1127,35 @@ private:
 		{
 			this->next();
 		}
-		else throw E(u8"expects '}'");
+		else return this->raise(E(u8"expects '}'"));
 
 		return ast;
 	}
 
-	inline constexpr auto decl_model() -> decl
+	inline constexpr auto decl_model() -> std::optional<decl>
 	{
-		auto ast {std::make_unique<model_decl>()};
+		TRACE;
+
+		auto ast {this->make<model_decl>()};
 		
-		ast->x = this->x;
-		ast->y = this->y;
+		static_cast<span&>(*ast) = this->pos;
 
 		this->next();
 
 		if (this->peek(atom::SYMBOL))
 		{
-			ast->name = // move
-			this->peek()->data;
+			ast->name = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 		}
-		else throw E(u8"expects 'ƒ'");
+		else return this->raise(E(u8"expects 'ƒ'"));
 
 		if (this->peek(atom::L_BRACE))
 		{
 			this->next();
 		}
-		else throw E(u8"expects '{'");
+		else return this->raise(E(u8"expects '{'"));
 
 		_start_:
 		// fresh construct
@@ -499,8 +1163,8 @@ private:
 
 		if (this->peek(atom::SYMBOL))
 		{
-			data.name = // move
-			this->peek()->data;
+			data.name = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 
@@ -508,63 +1172,64 @@ private:
 			{
 				this->next();
 			}
-			else throw E(u8"expects ':'");
+			else return this->raise(E(u8"expects ':'"));
 
 			if (this->peek(atom::SYMBOL))
 			{
-				data.type = // move
-				this->peek()->data;
+				data.type = // copy
+				this->word(this->peek()->data);
 
 				this->next();
 			}
-			else throw E(u8"expects 'ƒ'");
+			else return this->raise(E(u8"expects 'ƒ'"));
 
 			if (this->peek(atom::S_COLON))
 			{
 				this->next();
 			}
-			else throw E(u8"expects ';'");
+			else return this->raise(E(u8"expects ';'"));
 
 			//|--------------<insert>--------------|
-			ast->body.emplace_back(std::move(data));
+			ast->body.emplace_back(this->exe.pool, std::move(data));
 			//|------------------------------------|
 			
 			goto _start_;
 		}
-		// else throw E(u8"expects 'ƒ'");
+		// else return this->raise(E(u8"expects 'ƒ'"));
 
 		if (this->peek(atom::R_BRACE))
 		{
 			this->next();
 		}
-		else throw E(u8"expects '}'");
+		else return this->raise(E(u8"expects '}'"));
 
 		return ast;
 	}
 
-	inline constexpr auto decl_trait() -> decl
+	inline constexpr auto decl_trait() -> std::optional<decl>
 	{
-		auto ast {std::make_unique<trait_decl>()};
+		TRACE;
+
+		auto ast {this->make<trait_decl>()};
 		
-		ast->x = this->x;
-		ast->y = this->y;
+		static_cast<span&>(*ast) = this->pos;
 
 		this->next();
 
 		if (this->peek(atom::SYMBOL))
 		{
-			ast->name = // move
-			this->peek()->data;
+			ast->name = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 		}
-		else throw E(u8"expects 'ƒ'");
+		else return this->raise(E(u8"expects 'ƒ'"));
 
 		if (this->peek(atom::L_BRACE))
 		{
 			this->next();
 		}
-		else throw E(u8"expects '{'");
+		else return this->raise(E(u8"expects '{'"));
 
 		// TODO
 
@@ -572,72 +1237,81 @@ private:
 		{
 			this->next();
 		}
-		else throw E(u8"expects '}'");
+		else return this->raise(E(u8"expects '}'"));
 
 		return ast;
 	}
 
 	inline constexpr auto _stmt() -> std::optional<stmt>
 	{
-		try
+		TRACE;
+
+		if (this->fail)
 		{
-			if (auto tkn {this->peek()})
+			return std::nullopt;
+		}
+
+		while (true)
+		{
+			auto out {[&]() -> std::optional<stmt>
 			{
-				switch (tkn->type)
+				if (auto tkn {this->peek()})
 				{
-					case atom::IF:
-					{
-						return this->stmt_if();
-					}
-					case atom::FOR:
+					switch (tkn->type)
 					{
-						return this->stmt_for();
-					}
-					case atom::MATCH:
-					{
-						return this->stmt_match();
-					}
-					case atom::WHILE:
-					{
-						return this->stmt_while();
-					}
-					case atom::L_PAREN:
-					{
-						return this->stmt_block();
-					}
-					case atom::BREAK:
-					{
-						return this->stmt_break();
-					}
-					case atom::RETURN:
-					{
-						return this->stmt_return();
-					}
-					case atom::CONTINUE:
-					{
-						return this->stmt_iterate();
+						case atom::IF:
+						{
+							return this->stmt_if();
+						}
+						case atom::FOR:
+						{
+							return this->stmt_for();
+						}
+						case atom::MATCH:
+						{
+							return this->stmt_match();
+						}
+						case atom::WHILE:
+						{
+							return this->stmt_while();
+						}
+						case atom::L_PAREN:
+						{
+							return this->stmt_block();
+						}
+						case atom::BREAK:
+						{
+							return this->stmt_break();
+						}
+						case atom::RETURN:
+						{
+							return this->stmt_return();
+						}
+						case atom::CONTINUE:
+						{
+							return this->stmt_iterate();
+						}
 					}
 				}
+				return std::nullopt;
 			}
-			return std::nullopt;
-		}
-		catch (error<A, B>& out)
-		{
-			// recovery
-			this->sync();
-			// diagnostics
-			this->exe.lint
-			.emplace_back(out);
+			()};
+
+			if (!this->fail) [[likely]]
+			{
+				return out;
+			}
+			this->recover();
 		}
-		return this->_stmt();
 	}
 
-	inline constexpr auto stmt_if() -> stmt
+	inline constexpr auto stmt_if() -> std::optional<stmt>
 	{
-		auto ast {std::make_unique<if_stmt>()};
+		TRACE;
 
-		ast->x = this->x;
-		ast->y = this->y;
+		auto ast {this->make<if_stmt>()};
+
+		static_cast<span&>(*ast) = this->pos;
 		
 		this->next();
 
@@ -649,29 +1323,29 @@ private:
 		{
 			this->next();
 		}
-		else throw E(u8"expects '('");
+		else return this->raise(E(u8"expects '('"));
 
 		if (auto out {this->_expr()})
 		{
 			data._if_ = std::move(*out);
 		}
-		else throw E(u8"invalid expr");
+		else return this->raise(E(u8"invalid expr"));
 
 		if (this->peek(atom::R_PAREN))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ')'");
+		else return this->raise(E(u8"expects ')'"));
 
 		_else_:
 		if (auto out {this->_stmt()})
 		{
 			data.then = std::move(*out);
 		}
-		else throw E(u8"invalid stmt");
+		else return this->raise(E(u8"invalid stmt"));
 
 		//|--------------<insert>--------------|
-		ast->body.emplace_back(std::move(data));
+		ast->body.emplace_back(this->exe.pool, std::move(data));
 		//|------------------------------------|
 
 		if (this->peek(atom::ELSE))
@@ -687,12 +1361,13 @@ private:
 		return ast;
 	}
 
-	inline constexpr auto stmt_for() -> stmt
+	inline constexpr auto stmt_for() -> std::optional<stmt>
 	{
-		auto ast {std::make_unique<for_stmt>()};
+		TRACE;
+
+		auto ast {this->make<for_stmt>()};
 
-		ast->x = this->x;
-		ast->y = this->y;
+		static_cast<span&>(*ast) = this->pos;
 		
 		this->next();
 
@@ -700,59 +1375,60 @@ private:
 		{
 			this->next();
 		}
-		else throw E(u8"expects '('");
+		else return this->raise(E(u8"expects '('"));
 
 		if (auto out {this->_expr()})
 		{
 			ast->init = std::move(*out);
 		}
-		else throw E(u8"invalid expr");
+		else return this->raise(E(u8"invalid expr"));
 
 		if (this->peek(atom::S_COLON))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ';'");
+		else return this->raise(E(u8"expects ';'"));
 
 		if (auto out {this->_expr()})
 		{
 			ast->_if_ = std::move(*out);
 		}
-		else throw E(u8"invalid expr");
+		else return this->raise(E(u8"invalid expr"));
 
 		if (this->peek(atom::S_COLON))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ';'");
+		else return this->raise(E(u8"expects ';'"));
 
 		if (auto out {this->_expr()})
 		{
 			ast->task = std::move(*out);
 		}
-		else throw E(u8"invalid expr");
+		else return this->raise(E(u8"invalid expr"));
 
 		if (this->peek(atom::R_PAREN))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ')'");
+		else return this->raise(E(u8"expects ')'"));
 
 		if (auto out {this->_stmt()})
 		{
 			ast->body = std::move(*out);
 		}
-		else throw E(u8"invalid stmt");
+		else return this->raise(E(u8"invalid stmt"));
 
 		return ast;
 	}
 
-	inline constexpr auto stmt_match() -> stmt
+	inline constexpr auto stmt_match() -> std::optional<stmt>
 	{
-		auto ast {std::make_unique<match_stmt>()};
+		TRACE;
 
-		ast->x = this->x;
-		ast->y = this->y;
+		auto ast {this->make<match_stmt>()};
+
+		static_cast<span&>(*ast) = this->pos;
 		
 		this->next();
 
@@ -760,25 +1436,25 @@ private:
 		{
 			this->next();
 		}
-		else throw E(u8"expects '('");
+		else return this->raise(E(u8"expects '('"));
 
 		if (auto out {this->_expr()})
 		{
 			ast->data = std::move(*out);
 		}
-		else throw E(u8"invalid expr");
+		else return this->raise(E(u8"invalid expr"));
 
 		if (this->peek(atom::R_PAREN))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ')'");
+		else return this->raise(E(u8"expects ')'"));
 
 		if (this->peek(atom::L_BRACE))
 		{
 			this->next();
 		}
-		else throw E(u8"expects '{'");
+		else return this->raise(E(u8"expects '{'"));
 
 		_case_:
 		// fresh construct
@@ -788,13 +1464,13 @@ private:
 		{
 			data._if_ = std::move(*out);
 		}
-		else throw E(u8"invalid expr");
+		else return this->raise(E(u8"invalid expr"));
 
 		if (this->peek(atom::COLON))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ':'");
+		else return this->raise(E(u8"expects ':'"));
 
 		_else_:
 
@@ -802,10 +1478,10 @@ private:
 		{
 			data.then = std::move(*out);
 		}
-		else throw E(u8"invalid stmt");
+		else return this->raise(E(u8"invalid stmt"));
 
 		//|--------------<insert>--------------|
-		ast->body.emplace_back(std::move(data));
+		ast->body.emplace_back(this->exe.pool, std::move(data));
 		//|------------------------------------|
 
 		if (this->peek(atom::CASE))
@@ -823,17 +1499,18 @@ private:
 		{
 			this->next();
 		}
-		else throw E(u8"expects '}'");
+		else return this->raise(E(u8"expects '}'"));
 
 		return ast;
 	}
 
-	inline constexpr auto stmt_while() -> stmt
+	inline constexpr auto stmt_while() -> std::optional<stmt>
 	{
-		auto ast {std::make_unique<while_stmt>()};
+		TRACE;
+
+		auto ast {this->make<while_stmt>()};
 
-		ast->x = this->x;
-		ast->y = this->y;
+		static_cast<span&>(*ast) = this->pos;
 		
 		this->next();
 
@@ -841,35 +1518,36 @@ private:
 		{
 			this->next();
 		}
-		else throw E(u8"expects '('");
+		else return this->raise(E(u8"expects '('"));
 
 		if (auto out {this->_expr()})
 		{
 			ast->_if_ = std::move(*out);
 		}
-		else throw E(u8"invalid expr");
+		else return this->raise(E(u8"invalid expr"));
 
 		if (this->peek(atom::R_PAREN))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ')'");
+		else return this->raise(E(u8"expects ')'"));
 
 		if (auto out {this->_stmt()})
 		{
 			ast->body = std::move(*out);
 		}
-		else throw E(u8"invalid stmt");
+		else return this->raise(E(u8"invalid stmt"));
 
 		return ast;
 	}
 
-	inline constexpr auto stmt_block() -> stmt
+	inline constexpr auto stmt_block() -> std::optional<stmt>
 	{
-		auto ast {std::make_unique<block_stmt>()};
+		TRACE;
 
-		ast->x = this->x;
-		ast->y = this->y;
+		auto ast {this->make<block_stmt>()};
+
+		static_cast<span&>(*ast) = this->pos;
 		
 		this->next();
 
@@ -877,7 +1555,7 @@ private:
 		{
 			this->next();
 		}
-		else throw E(u8"expects '{'");
+		else return this->raise(E(u8"expects '{'"));
 
 		while (true)
 		{
@@ -885,7 +1563,7 @@ private:
 			{
 				std::visit([&](auto&& ptr)
 				{
-					ast->body.emplace_back(std::forward<decltype(ptr)>(ptr));
+					ast->body.emplace_back(this->exe.pool, std::forward<decltype(ptr)>(ptr));
 				},
 				std::move(*out)); // unwrap
 				continue;
@@ -894,7 +1572,7 @@ private:
 			{
 				std::visit([&](auto&& ptr)
 				{
-					ast->body.emplace_back(std::forward<decltype(ptr)>(ptr));
+					ast->body.emplace_back(this->exe.pool, std::forward<decltype(ptr)>(ptr));
 				},
 				std::move(*out)); // unwrap
 				continue;
@@ -905,53 +1583,56 @@ private:
 				{
 					this->next();
 				}
-				else throw E(u8"expects ';'");
+				else return this->raise(E(u8"expects ';'"));
 
 				std::visit([&](auto&& ptr)
 				{
-					ast->body.emplace_back(std::forward<decltype(ptr)>(ptr));
+					ast->body.emplace_back(this->exe.pool, std::forward<decltype(ptr)>(ptr));
 				},
 				std::move(*out)); // unwrap
 				continue;
 			}
+			break;
 		}
 
 		if (this->peek(atom::R_BRACE))
 		{
 			this->next();
 		}
-		else throw E(u8"expects '}'");
+		else return this->raise(E(u8"expects '}'"));
 
 		return ast;
 	}
 
-	inline constexpr auto stmt_break() -> stmt
+	inline constexpr auto stmt_break() -> std::optional<stmt>
 	{
-		auto ast {std::make_unique<break_stmt>()};
+		TRACE;
 
-		ast->x = this->x;
-		ast->y = this->y;
+		auto ast {this->make<break_stmt>()};
+
+		static_cast<span&>(*ast) = this->pos;
 		
 		this->next();
 
 		if (this->peek(atom::SYMBOL))
 		{
-			ast->label = // move
-			this->peek()->data;
+			ast->label = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 		}
-		// else throw E(u8"expects 'ƒ'");
+		// else return this->raise(E(u8"expects 'ƒ'"));
 
 		return ast;
 	}
 
-	inline constexpr auto stmt_return() -> stmt
+	inline constexpr auto stmt_return() -> std::optional<stmt>
 	{
-		auto ast {std::make_unique<return_stmt>()};
+		TRACE;
+
+		auto ast {this->make<return_stmt>()};
 
-		ast->x = this->x;
-		ast->y = this->y;
+		static_cast<span&>(*ast) = this->pos;
 
 		this->next();
 
@@ -959,118 +1640,64 @@ private:
 		{
 			ast->value = std::move(*out);
 		}
-		// else throw E(u8"invalid expr");
+		// else return this->raise(E(u8"invalid expr"));
 
 		if (this->peek(atom::S_COLON))
 		{
 			this->next();
 		}
-		else throw E(u8"expects ';'");
+		else return this->raise(E(u8"expects ';'"));
 
 		return ast;
 	}
 
-	inline constexpr auto stmt_iterate() -> stmt
+	inline constexpr auto stmt_iterate() -> std::optional<stmt>
 	{
-		auto ast {std::make_unique<iterate_stmt>()};
+		TRACE;
 
-		ast->x = this->x;
-		ast->y = this->y;
+		auto ast {this->make<iterate_stmt>()};
+
+		static_cast<span&>(*ast) = this->pos;
 		
 		this->next();
 
 		if (this->peek(atom::SYMBOL))
 		{
-			ast->label = // move
-			this->peek()->data;
+			ast->label = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 		}
-		// else throw E(u8"expects 'ƒ'");
+		// else return this->raise(E(u8"expects 'ƒ'"));
 
 		return ast;
 	}
 
 	inline constexpr auto _expr(uint8_t mbp = 0) -> std::optional<expr>
 	{
-		try
+		TRACE;
+
+		if (this->fail)
 		{
-			expr lhs;
+			return std::nullopt;
+		}
 
-			if (auto tkn {this->peek()})
+		while (true)
+		{
+			auto out {[&]() -> std::optional<expr>
 			{
-				// null denoation
-				if (auto power {parser::get_prefix_binding_power(tkn->type)})
-				{
-					auto [     rbp] {*power};
-
-					auto ast {std::make_unique<prefix_expr>()};
-
-					ast->x = this->x;
-					ast->y = this->y;
-
-					this->next();
-
-					if (auto out {this->_expr()})
-					{
-						switch (tkn->type)
-						{
-							#define macro(K, V) \
-							case atom::K:       \
-							{                   \
-							    ast->op = op::K;\
-							    break;          \
-							}                   \
-
-							operators(macro)
-							#undef macro
-
-							default:
-							{
-								assert(!"<ERROR>");
-								std::unreachable();
-							}
-						}
-						ast->rhs = std::move(*out);
-					}
-					else throw E(u8"invalid expr");
+				expr lhs;
 
-					lhs = std::move(ast);
-				}
-				else
+				if (auto tkn {this->peek()})
 				{
-					// handle primary
-					if (auto out {this->expr_group()})
-					{
-						lhs = std::move(*out);
-						goto LED;
-					}
-					if (auto out {this->expr_symbol()})
-					{
-						lhs = std::move(*out);
-						goto LED;
-					}
-					if (auto out {this->expr_literal()})
+					// null denoation
+					if (auto power {parser::get_prefix_binding_power(tkn->type)})
 					{
-						lhs = std::move(*out);
-						goto LED;
-					}
-					return std::nullopt;
-				}
-
-				LED:
-				// left denotation
-				while (auto tkn {this->peek()})
-				{
-					if (auto power {parser::get_infix_binding_power(tkn->type)})
-					{
-						auto [lbp, rbp] {*power};
-						if (rbp < mbp) break;
+						auto [     rbp] {*power};
 
-						auto ast {std::make_unique<binary_expr>()};
+						auto ast {this->make<prefix_expr>()};
 
-						ast->x = this->x;
-						ast->y = this->y;
+						static_cast<span&>(*ast) = this->pos;
 
 						this->next();
 
@@ -1081,8 +1708,8 @@ private:
 								#define macro(K, V) \
 								case atom::K:       \
 								{                   \
-									ast->op = op::K;\
-									break;          \
+								    ast->op = op::K;\
+								    break;          \
 								}                   \
 
 								operators(macro)
@@ -1094,46 +1721,114 @@ private:
 									std::unreachable();
 								}
 							}
-							ast->lhs = std::move(lhs);
 							ast->rhs = std::move(*out);
 						}
-						else throw E(u8"invalid expr");
+						else return this->raise(E(u8"invalid expr"));
 
 						lhs = std::move(ast);
-						continue;
 					}
-					if (auto power {parser::get_suffix_binding_power(tkn->type)})
+					else
 					{
-						auto [     rbp] {*power};
-						if (rbp < mbp) break;
-
-						// handle suffix
-						if (auto out {this->expr_access()})
+						// handle primary
+						if (auto out {this->expr_group()})
 						{
 							lhs = std::move(*out);
-							continue;
+							goto LED;
+						}
+						if (this->fail)
+						{
+							return std::nullopt;
+						}
+						if (auto out {this->expr_symbol()})
+						{
+							lhs = std::move(*out);
+							goto LED;
 						}
-						if (auto out {this->expr_invoke()})
+						if (auto out {this->expr_literal()})
 						{
 							lhs = std::move(*out);
+							goto LED;
+						}
+						return std::nullopt;
+					}
+
+					LED:
+					// left denotation
+					while (auto tkn {this->peek()})
+					{
+						if (auto power {parser::get_infix_binding_power(tkn->type)})
+						{
+							auto [lbp, rbp] {*power};
+							if (rbp < mbp) break;
+
+							auto ast {this->make<binary_expr>()};
+
+							static_cast<span&>(*ast) = this->pos;
+
+							this->next();
+
+							if (auto out {this->_expr()})
+							{
+								switch (tkn->type)
+								{
+									#define macro(K, V) \
+									case atom::K:       \
+									{                   \
+										ast->op = op::K;\
+										break;          \
+									}                   \
+
+									operators(macro)
+									#undef macro
+
+									default:
+									{
+										assert(!"<ERROR>");
+										std::unreachable();
+									}
+								}
+								ast->lhs = std::move(lhs);
+								ast->rhs = std::move(*out);
+							}
+							else return this->raise(E(u8"invalid expr"));
+
+							lhs = std::move(ast);
 							continue;
 						}
-						throw E(u8"parselet ???");
+						if (auto power {parser::get_suffix_binding_power(tkn->type)})
+						{
+							auto [     rbp] {*power};
+							if (rbp < mbp) break;
+
+							// handle suffix
+							if (auto out {this->expr_access()})
+							{
+								lhs = std::move(*out);
+								continue;
+							}
+							if (auto out {this->expr_invoke()})
+							{
+								lhs = std::move(*out);
+								continue;
+							}
+							return this->raise(E(u8"parselet ???"));
+						}
+						break;
 					}
-					break;
 				}
+				// eof; no expr, not a null one
+				else return std::nullopt;
+
+				return lhs;
 			}
-			return lhs;
-		}
-		catch (error<A, B>& out)
-		{
-			// recovery
-			this->sync();
-			// diagnostics
-			this->exe.lint
-			.emplace_back(out);
+			()};
+
+			if (!this->fail) [[likely]]
+			{
+				return out;
+			}
+			this->recover();
 		}
-		return this->_expr();
 	}
 
 	//|-----------------------|
@@ -1142,15 +1837,16 @@ private:
 
 	inline constexpr auto expr_literal() -> std::optional<expr>
 	{
+		TRACE;
+
 		if (this->peek(atom::TRUE))
 		{
-			auto ast {std::make_unique<literal_expr>()};
+			auto ast {this->make<literal_expr>()};
 
-			ast->x = this->x;
-			ast->y = this->y;
+			static_cast<span&>(*ast) = this->pos;
 
-			ast->self = // move
-			this->peek()->data;
+			ast->self = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 
@@ -1160,13 +1856,12 @@ private:
 		}
 		if (this->peek(atom::FALSE))
 		{
-			auto ast {std::make_unique<literal_expr>()};
+			auto ast {this->make<literal_expr>()};
 
-			ast->x = this->x;
-			ast->y = this->y;
+			static_cast<span&>(*ast) = this->pos;
 
-			ast->self = // move
-			this->peek()->data;
+			ast->self = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 
@@ -1176,13 +1871,12 @@ private:
 		}
 		if (this->peek(atom::CODE))
 		{
-			auto ast {std::make_unique<literal_expr>()};
+			auto ast {this->make<literal_expr>()};
 
-			ast->x = this->x;
-			ast->y = this->y;
+			static_cast<span&>(*ast) = this->pos;
 
-			ast->self = // move
-			this->peek()->data;
+			ast->self = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 
@@ -1192,13 +1886,12 @@ private:
 		}
 		if (this->peek(atom::TEXT))
 		{
-			auto ast {std::make_unique<literal_expr>()};
+			auto ast {this->make<literal_expr>()};
 
-			ast->x = this->x;
-			ast->y = this->y;
+			static_cast<span&>(*ast) = this->pos;
 
-			ast->self = // move
-			this->peek()->data;
+			ast->self = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 
@@ -1206,15 +1899,17 @@ private:
 
 			return ast;
 		}
-		if (this->peek(atom::INT))
+		if (this->peek(atom::INT) || this->peek(atom::BIN) || this->peek(atom::OCT) || this->peek(atom::HEX))
 		{
-			auto ast {std::make_unique<literal_expr>()};
+			auto ast {this->make<literal_expr>()};
 
-			ast->x = this->x;
-			ast->y = this->y;
+			static_cast<span&>(*ast) = this->pos;
 
-			ast->self = // move
-			this->peek()->data;
+			ast->self = // copy
+			this->word(this->peek()->data);
+
+			ast->value = // copy
+			this->peek()->value;
 
 			this->next();
 
@@ -1224,13 +1919,15 @@ private:
 		}
 		if (this->peek(atom::DEC))
 		{
-			auto ast {std::make_unique<literal_expr>()};
+			auto ast {this->make<literal_expr>()};
+
+			static_cast<span&>(*ast) = this->pos;
 
-			ast->x = this->x;
-			ast->y = this->y;
+			ast->self = // copy
+			this->word(this->peek()->data);
 
-			ast->self = // move
-			this->peek()->data;
+			ast->value = // copy
+			this->peek()->value;
 
 			this->next();
 
@@ -1243,15 +1940,16 @@ private:
 
 	inline constexpr auto expr_symbol() -> std::optional<expr>
 	{
+		TRACE;
+
 		if (this->peek(atom::SYMBOL))
 		{
-			auto ast {std::make_unique<symbol_expr>()};
+			auto ast {this->make<symbol_expr>()};
 
-			ast->x = this->x;
-			ast->y = this->y;
+			static_cast<span&>(*ast) = this->pos;
 
-			ast->self = // move
-			this->peek()->data;
+			ast->self = // copy
+			this->word(this->peek()->data);
 
 			this->next();
 
@@ -1262,12 +1960,13 @@ private:
 
 	inline constexpr auto expr_group() -> std::optional<expr>
 	{
+		TRACE;
+
 		if (this->peek(atom::L_PAREN))
 		{
-			auto ast {std::make_unique<group_expr>()};
+			auto ast {this->make<group_expr>()};
 
-			ast->x = this->x;
-			ast->y = this->y;
+			static_cast<span&>(*ast) = this->pos;
 
 			this->next();
 
@@ -1275,13 +1974,13 @@ private:
 			{
 				ast->self = std::move(*out);
 			}
-			else throw E(u8"invalid expr");
+			else return this->raise(E(u8"invalid expr"));
 
 			if (this->peek(atom::R_PAREN))
 			{
 				this->next();
 			}
-			else throw E(u8"expects ')'");
+			else return this->raise(E(u8"expects ')'"));
 
 			return ast;
 		}
@@ -1294,11 +1993,15 @@ private:
 
 	inline constexpr auto expr_access() -> std::optional<expr>
 	{
+		TRACE;
+
 		return std::nullopt;
 	}
 
 	inline constexpr auto expr_invoke() -> std::optional<expr>
 	{
+		TRACE;
+
 		return std::nullopt;
 	}
 
@@ -1402,4 +2105,6 @@ private:
 		}
 		return std::nullopt;
 	}
+
+	#undef TRACE
 };
@@ -1,11 +1,19 @@
+#include <random>
+#include <string>
+#include <cstdlib>
+#include <fstream>
+#include <filesystem>
 #include <variant>
 #include <iostream>
 
 #include "core/fs.hpp"
+#include "core/trace.hpp"
 
 #include "lang/lexer.hpp"
 #include "lang/parser.hpp"
 
+#include "lang/common/flat.hpp"
+
 #include "lang/backend/analyzer.hpp"
 #include "lang/backend/compiler.hpp"
 
@@ -23,35 +31,108 @@ auto main() -> int
 	}
 	#endif//MSC_VER
 
+	if (std::getenv("MOE_TRACE"))
+	{
+		trace::enable();
+	}
+
 	if (auto io {fs::open(path)})
 	{
 		std::visit([&](auto&& file)
 		{
-			lexer
+			AST
 			<
 				decltype(file.path),
 				decltype(file.data)
 			>
-			lexer {&file};
+			exe;
 
-			parser
-			<
-				decltype(file.path),
-				decltype(file.data)
-			>
-			parser {&lexer};
+			const auto key {file.hash()};
+
+			const auto sys {std::filesystem::path(path.c_str()).replace_extension(".moeast")};
 
 			//|---------------------|
-			//| frontend -> backend |
+			//| .moeast -> frontend |
 			//|---------------------|
 
-			auto exe {parser.pull()};
+			if (auto ast {flat::load(fs::map(sys).data(), key)})
+			{
+				ast->file = file.id;
+				ast->into(exe);
+			}
+			else
+			{
+				lexer
+				<
+					decltype(file.path),
+					decltype(file.data)
+				>
+				lexer {&file};
+
+				parser
+				<
+					decltype(file.path),
+					decltype(file.data)
+				>
+				parser {&lexer};
+
+				exe = parser.pull();
+
+				// diagnostics are not cached
+				if (exe.lint.empty())
+				{
+					// written aside, then renamed over; never seen half done
+					auto tmp {sys};
+
+					tmp += "." + std::to_string(std::random_device {}()) + ".tmp";
+
+					bool done {false};
+
+					if (const auto ast {flat::from(exe)})
+					{
+						if (std::ofstream ofs {tmp, std::ios::binary})
+						{
+							ast->save(ofs, key);
+
+							done = ofs.flush().good();
+						}
+					}
+
+					std::error_code ec;
+
+					if (done)
+					{
+						std::filesystem::rename(tmp, sys, ec);
+					}
+					if (!done || ec)
+					{
+						std::filesystem::remove(tmp, ec);
+					}
+				}
+			}
+
+			//|---------------------|
+			//| frontend -> backend |
+			//|---------------------|
 
 			for (auto& _ : exe.lint)
 			{
 				std::cout << _ << '\n';
 			}
+			const auto seen {exe.lint.size()};
+
 			compiler().compile(exe);
+
+			// from lazy bodies, parsed on demand
+			for (auto i {seen}; i < exe.lint.size(); ++i)
+			{
+				std::cout << exe.lint[i] << '\n';
+			}
+
+			if (trace::enabled())
+			{
+				trace::dump<atom>();
+			}
 		},
 		io.value());
 	}
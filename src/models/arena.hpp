@@ -0,0 +1,241 @@
+#pragma once
+
+#include <new>
+#include <memory>
+#include <iterator>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include "traits/rule_of_5.hpp"
+
+//|---------------------------------------------|
+//| bump allocator with bulk release.           |
+//|                                             |
+//| objects are carved out of geometrically     |
+//| growing pages and never freed one by one.   |
+//| destructors, if not trivial, run in reverse |
+//| order of construction, in a flat loop.      |
+//|---------------------------------------------|
+
+class arena
+{
+	static constexpr const size_t MIN {1 << 12};
+	static constexpr const size_t MAX {1 << 20};
+
+	struct dtor
+	{
+		void* ptr;
+		void (*call)(void*);
+	};
+
+	std::vector<std::unique_ptr<std::byte[]>> pages;
+	std::vector<dtor> dtors;
+
+	std::byte* head {nullptr};
+	std::byte* tail {nullptr};
+
+	// next page size
+	size_t grow {MIN};
+	// statistics
+	size_t total {0};
+	size_t count {0};
+
+	inline auto alloc(const size_t size, const size_t align) -> void*
+	{
+		assert(align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+		auto ptr {reinterpret_cast<uintptr_t>(this->head)};
+		// round up
+		ptr = (ptr + align - 1) & ~(align - 1);
+
+		if (this->head == nullptr || reinterpret_cast<uintptr_t>(this->tail) < ptr + size)
+		{
+			const auto bytes {std::max(this->grow, size)};
+
+			this->pages.emplace_back(new std::byte[bytes]);
+
+			this->head = this->pages.back().get();
+			this->tail = this->head + bytes;
+
+			this->grow = std::min(this->grow * 2, MAX);
+			this->total += bytes;
+
+			ptr = reinterpret_cast<uintptr_t>(this->head);
+		}
+		this->head = reinterpret_cast<std::byte*>(ptr + size);
+
+		return reinterpret_cast<void*>(ptr);
+	}
+
+public:
+
+	arena() = default;
+
+	~arena()
+	{
+		for (auto it {this->dtors.rbegin()}; it != this->dtors.rend(); ++it)
+		{
+			it->call(it->ptr);
+		}
+		// pages are released by unique_ptr
+	}
+
+	COPY_CONSTRUCTOR(arena) = delete;
+
+	MOVE_CONSTRUCTOR(arena)
+	:
+	pages {std::move(other.pages)},
+	dtors {std::move(other.dtors)},
+	head {std::exchange(other.head, nullptr)},
+	tail {std::exchange(other.tail, nullptr)},
+	grow {std::exchange(other.grow, MIN)},
+	total {std::exchange(other.total, 0)},
+	count {std::exchange(other.count, 0)} {}
+
+	COPY_ASSIGNMENT(arena) = delete;
+
+	MOVE_ASSIGNMENT(arena)
+	{
+		if (this != &rhs)
+		{
+			std::swap(this->pages, rhs.pages);
+			std::swap(this->dtors, rhs.dtors);
+			std::swap(this->head, rhs.head);
+			std::swap(this->tail, rhs.tail);
+			std::swap(this->grow, rhs.grow);
+			std::swap(this->total, rhs.total);
+			std::swap(this->count, rhs.count);
+		}
+		return *this;
+	}
+
+	//|-----------------|
+	//| member function |
+	//|-----------------|
+
+	template
+	<
+		typename    U,
+		typename... X
+	>
+	inline auto make(X&&... args) -> U*
+	{
+		auto* ptr {new (this->alloc(sizeof(U), alignof(U))) U {std::forward<X>(args)...}};
+
+		if constexpr (!std::is_trivially_destructible_v<U>)
+		{
+			this->dtors.push_back({ptr, [](void* ptr)
+			{
+				static_cast<U*>(ptr)->~U();
+			}});
+		}
+		++this->count;
+
+		return ptr;
+	}
+
+	template
+	<
+		typename U
+	>
+	// uninitialized room for N objects; never destroyed
+	inline auto array(const size_t size) -> U*
+	{
+		static_assert(std::is_trivially_destructible_v<U>);
+
+		++this->count;
+
+		return static_cast<U*>(this->alloc(sizeof(U) * size, alignof(U)));
+	}
+
+	//|-----------------------------------------|
+	//| growable array inside an arena; on      |
+	//| growth the old block is left behind, as |
+	//| nothing is freed one by one. the arena  |
+	//| is passed in, so moving it is harmless. |
+	//|-----------------------------------------|
+
+	template
+	<
+		typename U
+	>
+	class list
+	{
+		static_assert(std::is_trivially_copyable_v<U>);
+		static_assert(std::is_trivially_destructible_v<U>);
+
+		U* head {nullptr};
+		uint32_t count {0};
+		uint32_t space {0};
+
+	public:
+
+		//|-----------------|
+		//| member function |
+		//|-----------------|
+
+		template
+		<
+			typename... X
+		>
+		inline auto emplace_back(arena& pool, X&&... args) -> U&
+		{
+			if (this->count == this->space)
+			{
+				this->space = std::max<uint32_t>(4, this->space * 2);
+
+				auto* ptr {pool.template array<U>(this->space)};
+
+				std::uninitialized_copy(this->begin(), this->end(), ptr);
+
+				this->head = ptr;
+			}
+			return *new (this->head + this->count++) U {std::forward<X>(args)...};
+		}
+
+		inline constexpr auto size() const -> size_t { return this->count; }
+		inline constexpr auto empty() const -> bool { return this->count == 0; }
+
+		inline constexpr auto begin() const -> const U* { return this->head; }
+		inline constexpr auto begin()       ->       U* { return this->head; }
+
+		inline constexpr auto end() const -> const U* { return this->head + this->count; }
+		inline constexpr auto end()       ->       U* { return this->head + this->count; }
+
+		inline constexpr auto operator[](const size_t nth) const -> const U& { return this->head[nth]; }
+		inline constexpr auto operator[](const size_t nth)       ->       U& { return this->head[nth]; }
+	};
+
+	// takes over every page of other; its objects stay where they are
+	inline auto merge(arena&& other)
+	{
+		this->pages.insert(this->pages.end(), std::make_move_iterator(other.pages.begin()), std::make_move_iterator(other.pages.end()));
+		this->dtors.insert(this->dtors.end(), other.dtors.begin(), other.dtors.end());
+
+		this->total += std::exchange(other.total, 0);
+		this->count += std::exchange(other.count, 0);
+
+		other.pages.clear();
+		other.dtors.clear();
+		other.head = nullptr;
+		other.tail = nullptr;
+		other.grow = MIN;
+	}
+
+	// # of objects
+	inline constexpr auto size() const -> size_t
+	{
+		return this->count;
+	}
+
+	// # of bytes reserved
+	inline constexpr auto capacity() const -> size_t
+	{
+		return this->total;
+	}
+};
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+
+#include "models/str.hpp"
+
+//|------------------------------|
+//| PHF(Perfect Hash Function)   |
+//|------------------------------|
+//| keys are hashed by their     |
+//| size, head, middle and tail  |
+//| code unit. a collision free  |
+//| seed is searched at compile  |
+//| time, so a lookup is exactly |
+//| one probe and one compare.   |
+//|------------------------------|
+
+template
+<
+	typename T,
+	size_t   N
+>
+requires
+(
+	std::has_single_bit(N)
+)
+class phf
+{
+	struct slot
+	{
+		const char8_t* key {nullptr};
+		// metadata
+		size_t size {0};
+		// storage
+		T data {};
+	};
+
+	uint64_t seed {0};
+	std::array<slot, N> data {};
+
+	template
+	<
+		typename U
+	>
+	static constexpr auto hash(const uint64_t seed, const U* str, const size_t size) -> size_t
+	{
+		//|-----------------------------------|
+		//| https://w.wiki/4B7p (FNV-1a hash) |
+		//|-----------------------------------|
+
+		uint64_t out {0xCBF29CE484222325 ^ seed};
+
+		out = (out ^ static_cast<uint32_t>(str[0 /**/])) * 0x100000001B3;
+		out = (out ^ static_cast<uint32_t>(str[size / 2])) * 0x100000001B3;
+		out = (out ^ static_cast<uint32_t>(str[size - 1])) * 0x100000001B3;
+		out = (out ^ static_cast<uint64_t>(size /*len*/)) * 0x100000001B3;
+
+		//|--------------------------------------|
+		//| https://w.wiki/8dFC (murmur3 fmix64) |
+		//|--------------------------------------|
+
+		out ^= out >> 33;
+		out *= 0xFF51AFD7ED558CCD;
+		out ^= out >> 33;
+
+		return out & (N - 1);
+	}
+
+	static constexpr auto length(const char8_t* key) -> size_t
+	{
+		size_t out {0};
+
+		for (; key[out]; ++out)
+		{
+			// keys must be ASCII
+			assert(key[out] < 0x80);
+		}
+		return out;
+	}
+
+public:
+
+	template
+	<
+		size_t   M,
+		typename F
+	>
+	consteval phf(const std::pair<const char8_t*, T> (&args)[M], F&& filter)
+	{
+		// (*≧▽≦) trial and error
+		for (; this->seed < 0xFFFF; ++this->seed)
+		{
+			if (this->place(args, filter))
+			{
+				return;
+			}
+		}
+		assert(!"<ERROR>");
+	}
+
+private:
+
+	template
+	<
+		size_t   M,
+		typename F
+	>
+	consteval auto place(const std::pair<const char8_t*, T> (&args)[M], F&& filter) -> bool
+	{
+		this->data = {};
+
+		for (const auto& [key, value] : args)
+		{
+			if (key == nullptr || !filter(key))
+			{
+				continue;
+			}
+
+			const auto size {phf::length(key)};
+			auto& slot {this->data[phf::hash(this->seed, key, size)]};
+
+			if (slot.key != nullptr)
+			{
+				return false; // collision
+			}
+			slot = {key, size, value};
+		}
+		return true;
+	}
+
+public:
+
+	//|-----------------|
+	//| member function |
+	//|-----------------|
+
+	// getter
+	inline constexpr auto operator[](const model::text auto& str) const -> std::optional<T>
+	{
+		const auto size {str.size()};
+
+		if (size == 0)
+		{
+			return std::nullopt;
+		}
+
+		const auto* ptr {&str.begin()};
+		const auto& slot {this->data[phf::hash(this->seed, ptr, size)]};
+
+		if (slot.size != size)
+		{
+			return std::nullopt;
+		}
+		for (size_t i {0}; i < size; ++i)
+		{
+			// keys are ASCII, so unit-wise compare is enough
+			if (static_cast<char32_t>(ptr[i]) != slot.key[i])
+			{
+				return std::nullopt;
+			}
+		}
+		return slot.data;
+	}
+};
@@ -671,6 +671,8 @@ public:
 
 	public:
 
+		slice() : head {nullptr}, tail {nullptr} {}
+
 		slice
 		(
 			decltype(head) head,
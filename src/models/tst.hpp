@@ -1,6 +1,9 @@
 #pragma once
 
+#include <array>
+#include <tuple>
 #include <vector>
+#include <string>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -12,6 +15,7 @@
 #include <initializer_list>
 
 #include "models/str.hpp"
+#include "models/arena.hpp"
 
 #include "utils/ordering.hpp"
 
@@ -38,71 +42,79 @@ class tst
 		node* left {nullptr};
 		node* middle {nullptr};
 		node* right {nullptr};
-
-		~node()
-		{
-			delete this->left;
-			delete this->middle;
-			delete this->right;
-		}
+		// cached AVL height (left/right only)
+		int8_t level {1};
 
 		static constexpr auto repair(node* a) -> node*
 		{
+			node::update(a);
+
 			auto balance {node::factor(a)};
 
 			// left heavy
 			if (+1 < balance)
 			{
-				// LL case
-				if (a->left->code < a->code)
-				{
-					return a = node::rotate_r(a);
-				}
 				// LR case
-				if (a->code < a->left->code)
+				if (node::factor(a->left) < 0)
 				{
 					a->left = node::rotate_l(a->left);
-					return a = node::rotate_r(a);
 				}
+				// LL case
+				return node::rotate_r(a);
 			}
 			// right heavy
 			if (balance < -1)
 			{
-				// RR case
-				if (a->code < a->right->code)
-				{
-					return a = node::rotate_l(a);
-				}
 				// RL case
-				if (a->right->code < a->code)
+				if (0 < node::factor(a->right))
 				{
 					a->right = node::rotate_r(a->right);
-					return a = node::rotate_l(a);
 				}
+				// RR case
+				return node::rotate_l(a);
 			}
 			return a;
 		}
 
-	private:
+		static constexpr auto height(const node* a) -> int8_t
+		{
+			return a == nullptr ? 0 : a->level;
+		}
 
-		static constexpr auto factor(node* a) -> int8_t
+		static constexpr auto update(node* a)
+		{
+			a->level = std::max(node::height(a->left), node::height(a->right)) + 1;
+		}
+
+		// its height if every level below is AVL & cached right, or -1
+		static constexpr auto verify(const node* a) -> int
 		{
 			if (a == nullptr) { return 0; }
 
-			auto left {node::height(a->left)};
-			auto right {node::height(a->right)};
+			const auto left {node::verify(a->left)};
+			const auto right {node::verify(a->right)};
 
-			return left - right; // delta height
+			if (left < 0 || right < 0 || node::verify(a->middle) < 0)
+			{
+				return -1;
+			}
+			if (left - right < -1 || 1 < left - right || a->level != std::max(left, right) + 1)
+			{
+				return -1;
+			}
+			return a->level;
 		}
 
-		static constexpr auto height(node* a) -> int8_t
+	private:
+
+		static constexpr auto factor(const node* a) -> int8_t
 		{
 			if (a == nullptr) { return 0; }
 
 			auto left {node::height(a->left)};
 			auto right {node::height(a->right)};
 
-			return std::max(left, right) + 1;
+			return left - right; // delta height
 		}
 
 		static constexpr auto rotate_l(node* a) -> node*
@@ -121,6 +133,9 @@ class tst
 			b->left = a;
 			a->right = c;
 
+			node::update(a);
+			node::update(b);
+
 			return b;
 		}
 
@@ -140,11 +155,16 @@ class tst
 			b->right = a;
 			a->left = c;
 
+			node::update(a);
+			node::update(b);
+
 			return b;
 		}
 	};
 
-	node* root; // unique_ptr..?
+	node* root {nullptr};
+	// owns every node
+	arena pool;
 
 	template
 	<
@@ -262,6 +282,47 @@ class tst
 		S src;
 		X str;
 
+		inline constexpr auto find() const -> node*
+		{
+			auto it {this->str.begin()};
+			auto ie {this->str.end()};
+
+			for (auto ptr {this->src.root}; ptr != nullptr && it != ie; ++it)
+			{
+				const auto code {*it};
+
+				while (ptr != nullptr)
+				{
+					switch (utils::cmp(code, ptr->code))
+					{
+						case utils::ordering::LESS:
+						{
+							ptr = ptr->left;
+							continue;
+						}
+						case utils::ordering::EQUAL:
+						{
+							goto exit;
+						}
+						case utils::ordering::GREATER:
+						{
+							ptr = ptr->right;
+							continue;
+						}
+					}
+				}
+				return nullptr;
+
+				exit:
+				if (auto nx {it}; ++nx == ie)
+				{
+					return ptr;
+				}
+				ptr = ptr->middle;
+			}
+			return nullptr;
+		}
+
 	public:
 
 		proxy
@@ -278,155 +339,620 @@ class tst
 		// getter
 		inline constexpr operator bool() const&& requires (std::is_class_v<T> ? std::is_empty_v<T> : false)
 		{
-			auto ptr {this->src.root};
+			auto ptr {this->find()};
+			// return true if found
+			return ptr ? ptr->data.has_value() : false;
+		}
 
-			size_t nth {0};
+		// getter
+		inline constexpr operator std::optional<T>() const&& requires (std::is_class_v<T> ? !std::is_empty_v<T> : true)
+		{
+			auto ptr {this->find()};
+			// return the value if found
+			return ptr ? ptr->data : std::nullopt;
+		}
+
+		// setter
+		inline constexpr auto operator=(const T& value)&& -> proxy& requires (!std::is_const_v<std::remove_reference_t<S>>)
+		{
+			auto it {this->str.begin()};
+			auto ie {this->str.end()};
+
+			assert(it != ie);
+
+			auto ptr {&this->src.root};
+
+			// the only left/right path that may go out of balance
+			std::vector<node**> stack;
 
-			for (const auto code : this->str)
+			bool fresh {false};
+
+			while (true)
 			{
+				const auto code {*it};
+
 				while (true)
 				{
-					if (ptr == nullptr)
+					if (!fresh)
 					{
-						return false;
+						// remember path
+						stack.emplace_back(ptr);
 					}
-					switch (utils::cmp(code, ptr->code))
+					if ((*ptr) == nullptr)
+					{
+						(*ptr) = this->src.pool.template make<node>(code);
+						fresh = true;
+					}
+					switch (utils::cmp(code, (*ptr)->code))
 					{
 						case utils::ordering::LESS:
 						{
-							ptr = ptr->left;
-							break;
+							ptr = &((*ptr)->left);
+							continue;
 						}
 						case utils::ordering::EQUAL:
 						{
-							if (nth < this->str.length() - 1)
-							{
-								ptr = ptr->middle;
-							}
 							goto exit;
 						}
 						case utils::ordering::GREATER:
 						{
-							ptr = ptr->right;
-							break;
+							ptr = &((*ptr)->right);
+							continue;
 						}
 					}
 				}
 				exit:
-				++nth;
+				if (++it == ie)
+				{
+					break;
+				}
+				if (!fresh)
+				{
+					// next level; above paths are untouched
+					stack.clear();
+				}
+				ptr = &((*ptr)->middle);
+			}
+			// set the node value
+			(*ptr)->data = value;
+
+			if (fresh)
+			{
+				// a new leaf; nothing to repair, yet its parent grew
+				stack.pop_back();
+			}
+
+			// bubble up to the level root
+			while (!stack.empty())
+			{
+				auto ptr {stack.back()};
+				stack.pop_back(); // POP!
+
+				const auto* old {*ptr};
+				const auto lvl {old->level};
+
+				*ptr = node::repair(*ptr);
+
+				if (*ptr == old && (*ptr)->level == lvl)
+				{
+					break; // settled
+				}
 			}
-			return ptr != nullptr;
+			return *this; // chain
 		}
+	};
 
-		// getter
-		inline constexpr operator std::optional<T>() const&& requires (std::is_class_v<T> ? !std::is_empty_v<T> : true)
+	//|------------------------------------------|
+	//| O(n) perfectly balanced bulk loading     |
+	//|------------------------------------------|
+	//| keys in [lo, hi) share their first depth |
+	//| codes, so codes at [depth] form sorted   |
+	//| runs; the median run becomes the root of |
+	//| this level, recursively on both halves.  |
+	//|------------------------------------------|
+
+	static auto bulk(arena& pool, const std::vector<std::pair<utf32, T>>& args, const size_t lo, const size_t hi, const size_t depth) -> node*
+	{
+		std::vector<size_t> runs {lo};
+
+		for (size_t i {lo + 1}; i < hi; ++i)
+		{
+			if (args[i].first.c_str()[depth] != args[i - 1].first.c_str()[depth])
+			{
+				runs.emplace_back(i);
+			}
+		}
+		runs.emplace_back(hi);
+
+		return tst::bulk(pool, args, runs, 0, runs.size() - 1, depth);
+	}
+
+	static auto bulk(arena& pool, const std::vector<std::pair<utf32, T>>& args, const std::vector<size_t>& runs, const size_t gl, const size_t gr, const size_t depth) -> node*
+	{
+		if (gl == gr)
 		{
-			auto ptr {this->src.root};
+			return nullptr;
+		}
 
-			size_t nth {0};
+		const auto mid {gl + (gr - gl) / 2};
+
+		auto lo {runs[mid + 0]};
+		auto hi {runs[mid + 1]};
+
+		auto* out {pool.make<node>(args[lo].first.c_str()[depth])};
+
+		// keys ending here
+		for (; lo < hi && args[lo].first.size() == depth + 1; ++lo)
+		{
+			out->data = args[lo].second;
+		}
+		if (lo < hi)
+		{
+			out->middle = tst::bulk(pool, args, lo, hi, depth + 1);
+		}
+		out->left = tst::bulk(pool, args, runs, gl, mid, depth);
+		out->right = tst::bulk(pool, args, runs, mid + 1, gr, depth);
+
+		node::update(out);
+
+		return out;
+	}
+
+	struct cell
+	{
+		char32_t code {0};
+		// children
+		uint32_t left {0};
+		uint32_t middle {0};
+		uint32_t right {0};
+	};
+
+	static_assert(sizeof(cell) == 16, "4 nodes per cache line");
+
+	//|--------------------------------------|
+	//| the bulk loading above, but during   |
+	//| constant evaluation. cells are glued |
+	//| by index (0 = sentinel) and are then |
+	//| relaid out in BFS order, as freeze() |
+	//|--------------------------------------|
+
+	template
+	<
+		size_t   M,
+		typename F
+	>
+	static consteval auto bake(const std::pair<const char8_t*, T> (&args)[M], F&& filter) -> std::vector<std::pair<cell, std::optional<T>>>
+	{
+		//|--------------------------|
+		//| step 1. decode & sort    |
+		//|--------------------------|
+
+		std::vector<std::pair<std::u32string, T>> keys;
 
-			for (const auto code : this->str)
+		for (const auto& [key, value] : args)
+		{
+			if (key == nullptr || *key == u8'\0' || !filter(key))
 			{
-				while (true)
+				continue;
+			}
+
+			std::u32string str;
+
+			for (auto ptr {key}; *ptr;)
+			{
+				char32_t code {0};
+
+				const auto width {utf8::codec::next(ptr)};
+				utf8::codec::decode(ptr, code, width);
+
+				str += code;
+				ptr += width;
+			}
+			keys.emplace_back(str, value);
+		}
+
+		std::sort(keys.begin(), keys.end(), [](const auto& lhs, const auto& rhs)
+		{
+			return lhs.first < rhs.first;
+		});
+
+		//|--------------------------|
+		//| step 2. balanced build   |
+		//|--------------------------|
+
+		std::vector<std::pair<cell, std::optional<T>>> temp(1);
+
+		const auto root {keys.empty() ? 0 : tst::bake(temp, keys, 0, keys.size(), 0)};
+
+		//|--------------------------|
+		//| step 3. BFS relayout     |
+		//|--------------------------|
+
+		std::vector<std::pair<cell, std::optional<T>>> out(1);
+
+		std::vector<uint32_t> queue;
+
+		if (root != 0)
+		{
+			queue.emplace_back(root);
+		}
+
+		// queue[i] becomes out[i + 1]
+		for (size_t i {0}; i < queue.size(); ++i)
+		{
+			auto [node, data] {temp[queue[i]]};
+
+			for (auto* link : {&node.left, &node.middle, &node.right})
+			{
+				if (*link != 0)
 				{
-					if (ptr == nullptr)
-					{
-						return std::nullopt;
-					}
-					switch (utils::cmp(code, ptr->code))
+					queue.emplace_back(*link);
+					*link = queue.size();
+				}
+			}
+			out.emplace_back(node, data);
+		}
+		return out;
+	}
+
+	static consteval auto bake(std::vector<std::pair<cell, std::optional<T>>>& out, const std::vector<std::pair<std::u32string, T>>& args, const size_t lo, const size_t hi, const size_t depth) -> uint32_t
+	{
+		std::vector<size_t> runs {lo};
+
+		for (size_t i {lo + 1}; i < hi; ++i)
+		{
+			if (args[i].first[depth] != args[i - 1].first[depth])
+			{
+				runs.emplace_back(i);
+			}
+		}
+		runs.emplace_back(hi);
+
+		return tst::bake(out, args, runs, 0, runs.size() - 1, depth);
+	}
+
+	static consteval auto bake(std::vector<std::pair<cell, std::optional<T>>>& out, const std::vector<std::pair<std::u32string, T>>& args, const std::vector<size_t>& runs, const size_t gl, const size_t gr, const size_t depth) -> uint32_t
+	{
+		if (gl == gr)
+		{
+			return 0;
+		}
+
+		const auto mid {gl + (gr - gl) / 2};
+
+		auto lo {runs[mid + 0]};
+		auto hi {runs[mid + 1]};
+
+		const uint32_t nth (out.size());
+
+		out.emplace_back(cell {args[lo].first[depth]}, std::nullopt);
+
+		// keys ending here
+		for (; lo < hi && args[lo].first.size() == depth + 1; ++lo)
+		{
+			out[nth].second = args[lo].second;
+		}
+		// out may grow; store by index
+		if (lo < hi)
+		{
+			const auto middle {tst::bake(out, args, lo, hi, depth + 1)};
+			out[nth].first.middle = middle;
+		}
+		const auto left {tst::bake(out, args, runs, gl, mid, depth)};
+		out[nth].first.left = left;
+
+		const auto right {tst::bake(out, args, runs, mid + 1, gr, depth)};
+		out[nth].first.right = right;
+
+		return nth;
+	}
+
+public:
+
+	//|--------------------------------|
+	//| read-only, contiguous snapshot |
+	//|--------------------------------|
+	//| nodes are laid out in BFS      |
+	//| order and linked by 32-bit     |
+	//| indices. index 0 is a sentinel |
+	//| that plays the role of nullptr |
+	//|                                |
+	//| C == 0 -> heap, from freeze()  |
+	//| C != 0 -> fixed, at compile    |
+	//|           time from a table    |
+	//|--------------------------------|
+
+	template
+	<
+		size_t C = 0
+	>
+	class frozen
+	{
+		friend tst;
+
+		typedef cell node;
+
+		// topology
+		std::conditional_t<C == 0, std::vector<node>, std::array<node, C + 1>> tree {};
+		// storage
+		std::conditional_t<C == 0, std::vector<std::optional<T>>, std::array<std::optional<T>, C + 1>> data {};
+
+	public:
+
+		frozen() requires (C == 0) : tree(1), data(1) {}
+
+		template
+		<
+			size_t   M,
+			typename F
+		>
+		requires
+		(
+			C != 0
+		)
+		consteval frozen(const std::pair<const char8_t*, T> (&args)[M], F&& filter)
+		{
+			const auto temp {tst::bake(args, filter)};
+
+			// see tst::count
+			assert(temp.size() == C + 1);
+
+			for (size_t i {0}; i < temp.size(); ++i)
+			{
+				this->tree[i] = temp[i].first;
+				this->data[i] = temp[i].second;
+			}
+		}
+
+		template
+		<
+			size_t M
+		>
+		requires
+		(
+			C != 0
+		)
+		consteval frozen(const std::pair<const char8_t*, T> (&args)[M])
+		:
+		frozen {args, [](const char8_t*) { return true; }} {}
+
+		class cursor
+		{
+			const frozen& src;
+			uint32_t      ptr;
+
+		public:
+
+			cursor
+			(
+				decltype(src) src,
+				decltype(ptr) ptr
+			)
+			: src {src}, ptr {ptr} {}
+
+			//|-----------------|
+			//| member function |
+			//|-----------------|
+
+			// getter
+			inline constexpr auto value() const -> std::optional<T>
+			{
+				return this->src.data[this->ptr];
+			}
+
+			inline constexpr auto reset()
+			{
+				this->ptr = 0;
+			}
+
+			inline constexpr auto is_root() const -> bool
+			{
+				return this->ptr == 0;
+			}
+
+			inline constexpr auto is_leaf() const -> bool
+			{
+				return this->src.tree[this->ptr].middle == 0;
+			}
+
+			inline constexpr auto is_child() const -> bool
+			{
+				return this->ptr != 0;
+			}
+
+			inline constexpr auto is_parent() const -> bool
+			{
+				return this->src.tree[this->ptr].middle != 0;
+			}
+
+			// incremental search
+			inline constexpr auto operator[](const char32_t idx) -> bool
+			{
+				uint32_t ptr
+				{
+					this->ptr == 0
+					?
+					this->src.head()
+					:
+					this->src.tree[this->ptr].middle
+				};
+
+				while (ptr != 0)
+				{
+					const auto& node {this->src.tree[ptr]};
+
+					switch (utils::cmp(idx, node.code))
 					{
 						case utils::ordering::LESS:
 						{
-							ptr = ptr->left;
+							ptr = node.left;
 							break;
 						}
 						case utils::ordering::EQUAL:
 						{
-							if (nth < this->str.length() - 1)
-							{
-								ptr = ptr->middle;
-							}
-							goto exit;
+							this->ptr = ptr;
+							return true;
 						}
 						case utils::ordering::GREATER:
 						{
-							ptr = ptr->right;
+							ptr = node.right;
 							break;
 						}
 					}
 				}
-				exit:
-				++nth;
+				return false;
 			}
-			// return the value if found
-			return ptr ? ptr->data : std::nullopt;
+		};
+
+	private:
+
+		inline constexpr auto head() const -> uint32_t
+		{
+			return this->tree.size() < 2 ? 0 : 1;
 		}
 
-		// setter
-		inline constexpr auto operator=(const T& value)&& -> proxy& requires (!std::is_const_v<std::remove_reference_t<S>>)
+	public:
+
+		//|-----------------|
+		//| member function |
+		//|-----------------|
+
+		inline constexpr auto size() const -> size_t
 		{
-			auto ptr {&this->src.root};
+			return this->tree.size() - 1;
+		}
 
-			size_t nth {0};
+		inline constexpr auto view() const -> cursor
+		{
+			return {*this, 0};
+		}
 
-			std::vector<node**> stack;
+		// maximal munch; stops at ie or U'\0'
+		template<typename I>
+		inline constexpr auto longest_match(I it, const I ie) const -> std::optional<std::pair<size_t, T>>
+		{
+			std::optional<std::pair<size_t, T>> out;
+
+			size_t nth {0};
 
-			for (const auto code : this->str)
+			for (auto ptr {this->head()}; ptr != 0 && it != ie; ++it)
 			{
-				while (true)
+				const auto code {*it};
+
+				if (code == U'\0')
+				{
+					break;
+				}
+				while (ptr != 0)
 				{
-					// remember path
-					stack.emplace_back(ptr);
+					const auto& node {this->tree[ptr]};
 
-					if ((*ptr) == nullptr)
-					{
-						(*ptr) = new node(code);
-					}
-					switch (utils::cmp(code, (*ptr)->code))
+					switch (utils::cmp(code, node.code))
 					{
 						case utils::ordering::LESS:
 						{
-							ptr = &((*ptr)->left);
-							break;
+							ptr = node.left;
+							continue;
 						}
 						case utils::ordering::EQUAL:
 						{
-							if (nth < this->str.length() - 1)
-							{
-								ptr = &((*ptr)->middle);
-							}
 							goto exit;
 						}
 						case utils::ordering::GREATER:
 						{
-							ptr = &((*ptr)->right);
-							break;
+							ptr = node.right;
+							continue;
 						}
 					}
 				}
+				break;
+
 				exit:
+				if (const auto& data {this->data[ptr]})
+				{
+					out = {nth + 1, *data};
+				}
 				++nth;
+				ptr = this->tree[ptr].middle;
 			}
-			// set the node value
-			(*ptr)->data = value;
+			return out;
+		}
 
-			// bubble up to the root
-			while (!stack.empty())
+		// maximal munch; stops at U'\0'
+		template<typename I>
+		inline constexpr auto longest_match(I it) const -> std::optional<std::pair<size_t, T>>
+		{
+			return this->longest_match(it, I {nullptr});
+		}
+
+		// getter
+		template<model::text S>
+		inline constexpr auto operator[](const S& str) const -> std::optional<T>
+		{
+			auto it {str.begin()};
+			auto ie {str.end()};
+
+			for (auto ptr {this->head()}; ptr != 0 && it != ie; ++it)
 			{
-				auto ptr {stack.back()};
-				stack.pop_back(); // POP!
-				*ptr = node::repair(*ptr);
+				const auto code {*it};
+
+				while (ptr != 0)
+				{
+					const auto& node {this->tree[ptr]};
+
+					switch (utils::cmp(code, node.code))
+					{
+						case utils::ordering::LESS:
+						{
+							ptr = node.left;
+							continue;
+						}
+						case utils::ordering::EQUAL:
+						{
+							goto exit;
+						}
+						case utils::ordering::GREATER:
+						{
+							ptr = node.right;
+							continue;
+						}
+					}
+				}
+				return std::nullopt;
+
+				exit:
+				if (auto nx {it}; ++nx == ie)
+				{
+					return this->data[ptr];
+				}
+				ptr = this->tree[ptr].middle;
 			}
-			return *this; // chain
+			return std::nullopt;
 		}
-	};
 
-public:
+		template<size_t N>
+		// converting constructor
+		inline constexpr auto operator[](const char8_t (&str)[N]) const -> std::optional<T>
+		{
+			return this->operator[](utf8 {str});
+		}
 
-	~tst()
-	{
-		delete this->root; // ok
-	}
+		template<size_t N>
+		// converting constructor
+		inline constexpr auto operator[](const char16_t (&str)[N]) const -> std::optional<T>
+		{
+			return this->operator[](utf16 {str});
+		}
+
+		template<size_t N>
+		// converting constructor
+		inline constexpr auto operator[](const char32_t (&str)[N]) const -> std::optional<T>
+		{
+			return this->operator[](utf32 {str});
+		}
+	};
+
+	~tst() = default; // arena
 
 	template<model::text S>
 	tst(std::initializer_list<std::pair<S&, T>> args = {})
@@ -464,15 +990,34 @@ public:
 		}
 	}
 
-	COPY_CONSTRUCTOR(tst)
+	// bulk constructor (sorted & unique keys)
+	template<model::text S>
+	tst(const std::vector<std::pair<S, T>>& args)
 	{
-		if (this != &other)
+		std::vector<std::pair<utf32, T>> temp;
+
+		temp.reserve(args.size());
+
+		for (const auto& [first, second] : args)
 		{
-			// TODO
+			if (!first.empty())
+			{
+				temp.emplace_back(first.to_utf32(), second);
+			}
+		}
+
+		assert(std::is_sorted(temp.begin(), temp.end(), [](const auto& lhs, const auto& rhs)
+		{
+			return lhs.first < rhs.first;
+		}));
+
+		if (!temp.empty())
+		{
+			this->root = tst::bulk(this->pool, temp, 0, temp.size(), 0);
 		}
 	}
 
-	MOVE_CONSTRUCTOR(tst)
+	COPY_CONSTRUCTOR(tst)
 	{
 		if (this != &other)
 		{
@@ -480,6 +1025,11 @@ public:
 		}
 	}
 
+	MOVE_CONSTRUCTOR(tst)
+	:
+	root {std::exchange(other.root, nullptr)},
+	pool {std::move(other.pool)} {}
+
 	COPY_ASSIGNMENT(tst)
 	{
 		if (this != &rhs)
@@ -493,7 +1043,8 @@ public:
 	{
 		if (this != &rhs)
 		{
-			// TODO
+			std::swap(this->root, rhs.root);
+			std::swap(this->pool, rhs.pool);
 		}
 		return *this;
 	}
@@ -502,6 +1053,230 @@ public:
 	//| member function |
 	//|-----------------|
 
+	// # of nodes a fixed frozen<C> needs
+	template
+	<
+		size_t   M,
+		typename F
+	>
+	static consteval auto count(const std::pair<const char8_t*, T> (&args)[M], F&& filter) -> size_t
+	{
+		return tst::bake(args, filter).size() - 1;
+	}
+
+	// # of nodes a fixed frozen<C> needs
+	template
+	<
+		size_t M
+	>
+	static consteval auto count(const std::pair<const char8_t*, T> (&args)[M]) -> size_t
+	{
+		return tst::count(args, [](const char8_t*) { return true; });
+	}
+
+	inline constexpr auto freeze() const -> frozen<>
+	{
+		frozen<> out;
+
+		std::vector<const node*> queue;
+
+		if (this->root != nullptr)
+		{
+			queue.emplace_back(this->root);
+		}
+
+		// BFS; queue[i] becomes out.tree[i + 1]
+		for (size_t i {0}; i < queue.size(); ++i)
+		{
+			const auto* ptr {queue[i]};
+
+			cell node {ptr->code};
+
+			if (ptr->left != nullptr)
+			{
+				node.left = queue.size() + 1;
+				queue.emplace_back(ptr->left);
+			}
+			if (ptr->middle != nullptr)
+			{
+				node.middle = queue.size() + 1;
+				queue.emplace_back(ptr->middle);
+			}
+			if (ptr->right != nullptr)
+			{
+				node.right = queue.size() + 1;
+				queue.emplace_back(ptr->right);
+			}
+			out.tree.emplace_back(node);
+			out.data.emplace_back(ptr->data);
+		}
+		assert(out.tree.size() <= UINT32_MAX);
+
+		return out;
+	}
+
+	// maximal munch; stops at ie or U'\0'
+	template<typename I>
+	inline constexpr auto longest_match(I it, const I ie) const -> std::optional<std::pair<size_t, T>>
+	{
+		std::optional<std::pair<size_t, T>> out;
+
+		size_t nth {0};
+
+		for (auto ptr {this->root}; ptr != nullptr && it != ie; ++it)
+		{
+			const auto code {*it};
+
+			if (code == U'\0')
+			{
+				break;
+			}
+			while (ptr != nullptr)
+			{
+				switch (utils::cmp(code, ptr->code))
+				{
+					case utils::ordering::LESS:
+					{
+						ptr = ptr->left;
+						continue;
+					}
+					case utils::ordering::EQUAL:
+					{
+						goto exit;
+					}
+					case utils::ordering::GREATER:
+					{
+						ptr = ptr->right;
+						continue;
+					}
+				}
+			}
+			break;
+
+			exit:
+			if (ptr->data)
+			{
+				out = {nth + 1, *ptr->data};
+			}
+			++nth;
+			ptr = ptr->middle;
+		}
+		return out;
+	}
+
+	// maximal munch; stops at U'\0'
+	template<typename I>
+	inline constexpr auto longest_match(I it) const -> std::optional<std::pair<size_t, T>>
+	{
+		return this->longest_match(it, I {nullptr});
+	}
+
+	//|---------------------------------------------|
+	//| every key within max_edits Levenshtein      |
+	//| distance, nearest first. one DP row is kept |
+	//| per depth, and a subtree is skipped as soon |
+	//| as its row's minimum exceeds the budget.    |
+	//|---------------------------------------------|
+
+	inline /*Ი︵𐑼*/ auto near(const model::text auto& key, const size_t max_edits) const -> std::vector<std::pair<utf32, T>>
+	{
+		const auto str {key.to_utf32()};
+		const auto len {str.size()};
+
+		// depth -> DP row
+		std::vector<std::vector<size_t>> rows {{}};
+		// depth -> code
+		std::vector<char32_t> path;
+
+		for (size_t j {0}; j <= len; ++j)
+		{
+			rows[0].emplace_back(j);
+		}
+
+		std::vector<std::pair<const node*, size_t>> stack;
+
+		if (this->root != nullptr)
+		{
+			stack.emplace_back(this->root, 0);
+		}
+
+		std::vector<std::tuple<size_t, utf32, T>> out;
+
+		while (!stack.empty())
+		{
+			const auto [ptr, depth] {stack.back()};
+			stack.pop_back(); // POP!
+
+			// siblings share this depth
+			if (ptr->left != nullptr)
+			{
+				stack.emplace_back(ptr->left, depth);
+			}
+			if (ptr->right != nullptr)
+			{
+				stack.emplace_back(ptr->right, depth);
+			}
+
+			if (rows.size() < depth + 2)
+			{
+				rows.resize(depth + 2);
+				path.resize(depth + 1);
+			}
+			path[depth] = ptr->code;
+
+			const auto& prev {rows[depth + 0]};
+			/*---*/ auto& next {rows[depth + 1]};
+
+			next.assign(len + 1, depth + 1);
+
+			auto min {next[0]};
+
+			for (size_t j {1}; j <= len; ++j)
+			{
+				next[j] = std::min
+				({
+					next[j - 1] + 1, // insert
+					prev[j - 0] + 1, // delete
+					prev[j - 1] + (str.c_str()[j - 1] != ptr->code), // replace
+				});
+				min = std::min(min, next[j]);
+			}
+
+			if (ptr->data && next[len] <= max_edits)
+			{
+				const std::u32string word(path.begin(), path.begin() + depth + 1);
+
+				out.emplace_back(next[len], utf32 {word.c_str()}, *ptr->data);
+			}
+			// prune
+			if (ptr->middle != nullptr && min <= max_edits)
+			{
+				stack.emplace_back(ptr->middle, depth + 1);
+			}
+		}
+
+		std::stable_sort(out.begin(), out.end(), [](const auto& lhs, const auto& rhs)
+		{
+			return std::get<0>(lhs) < std::get<0>(rhs);
+		});
+
+		std::vector<std::pair<utf32, T>> result;
+
+		result.reserve(out.size());
+
+		for (auto& [cost, word, data] : out)
+		{
+			result.emplace_back(std::move(word), std::move(data));
+		}
+		return result;
+	}
+
+	// AVL invariant of every level
+	inline constexpr auto balanced() const -> bool
+	{
+		return 0 <= node::verify(this->root);
+	}
+
 	inline constexpr auto view() const -> cursor<decltype(*this)>
 	{
 		return {*this, nullptr};
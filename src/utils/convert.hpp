@@ -1,8 +1,13 @@
 #pragma once
 
+#include <bit>
 #include <array>
+#include <string>
+#include <charconv>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <optional>
 #include <type_traits>
 
 #include "models/str.hpp"
@@ -42,6 +47,148 @@ namespace utils
 		};
 	}
 
+	//|-----------------------------------|
+	//| exact literal decoding; no signs, |
+	//| digits only, std::nullopt if the  |
+	//| value doesn't fit.                |
+	//|-----------------------------------|
+
+	namespace // private
+	{
+		//|------------------------------------------------------------------------|
+		//| https://lemire.me/blog/2022/01/21/swar-explained-parsing-eight-digits/ |
+		//|------------------------------------------------------------------------|
+
+		inline constexpr auto swar(uint64_t chunk) -> uint64_t
+		{
+			chunk -= 0x3030303030303030;
+			chunk = (chunk * 10) + (chunk >> 8);
+			chunk =
+			(
+				((chunk & 0x000000FF000000FF) * (100 + (1000000ULL << 32)))
+				+
+				(((chunk >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))
+			)
+			>> 32;
+
+			return chunk;
+		}
+	}
+
+	// radix 2, 8, 10 or 16
+	template
+	<
+		typename T
+	>
+	inline constexpr auto parse_int(const T* head, const T* tail, const uint8_t radix) -> std::optional<uint64_t>
+	{
+		assert(radix == 2 || radix == 8 || radix == 10 || radix == 16);
+
+		// leading zeros are free
+		for (; head != tail && *head == '0'; ++head);
+
+		uint64_t out {0};
+
+		if (radix != 10)
+		{
+			const auto bits {std::countr_zero(radix)};
+
+			for (; head != tail; ++head)
+			{
+				if (out >> (64 - bits))
+				{
+					return std::nullopt;
+				}
+				out = (out << bits) | TBL[*head];
+			}
+			return out;
+		}
+
+		// 10^19 - 1 < 2^64 - 1 < 10^20 - 1
+		if (20 < tail - head)
+		{
+			return std::nullopt;
+		}
+
+		const auto* last {tail - head == 20 ? tail - 1 : tail};
+
+		if !consteval
+		{
+			if constexpr (sizeof(T) == 1 && std::endian::native == std::endian::little)
+			{
+				for (; 8 <= last - head; head += 8)
+				{
+					uint64_t chunk;
+					std::memcpy(&chunk, head, 8);
+
+					out = out * 100000000 + utils::swar(chunk);
+				}
+			}
+		}
+		for (; head != last; ++head)
+		{
+			out = out * 10 + (*head - '0');
+		}
+
+		// 20th digit
+		if (last != tail)
+		{
+			const uint64_t code (*last - '0');
+
+			if ((UINT64_MAX - code) / 10 < out)
+			{
+				return std::nullopt;
+			}
+			out = out * 10 + code;
+		}
+		return out;
+	}
+
+	// correctly rounded; std::from_chars is Eisel-Lemire in every major STL
+	template
+	<
+		typename T
+	>
+	inline /*Ი︵𐑼*/ auto parse_dec(const T* head, const T* tail) -> std::optional<double>
+	{
+		double out {0};
+
+		const auto [_, err]
+		{
+			[&]
+			{
+				if constexpr (sizeof(T) == 1)
+				{
+					return std::from_chars
+					(
+						reinterpret_cast<const char*>(head),
+						reinterpret_cast<const char*>(tail),
+						out
+					);
+				}
+				else
+				{
+					// digits & '.' are ASCII in every encoding
+					const std::string ascii (head, tail);
+
+					return std::from_chars
+					(
+						ascii.data(),
+						ascii.data() + ascii.size(),
+						out
+					);
+				}
+			}
+			()
+		};
+
+		if (err != std::errc {})
+		{
+			return std::nullopt;
+		}
+		return out;
+	}
+
 	//|------------------|
 	//| string to number |
 	//|------------------|
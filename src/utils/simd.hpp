@@ -0,0 +1,231 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+//|-----------------------------------------|
+//| 16 bytes at a time scans, for any unit. |
+//|                                         |
+//| inputs are NUL terminated, so every     |
+//| scan stops at '\0' as well. loads are   |
+//| 16-byte aligned and can't cross a page, |
+//| but may read past the terminator; hence |
+//| ASAN is told to look the other way.     |
+//|-----------------------------------------|
+
+namespace utils
+{
+	namespace // private
+	{
+#if defined(__SSE2__)
+		// 1 mask bit per byte; a unit is sizeof(T) bits, all equal
+		template
+		<
+			typename T
+		>
+		[[gnu::no_sanitize_address]]
+		inline /*Ი︵𐑼*/ auto align(const T* ptr, const auto& match) -> const T*
+		{
+			const auto off {reinterpret_cast<uintptr_t>(ptr) & 15};
+			auto* blk {reinterpret_cast<const __m128i*>(reinterpret_cast<const char*>(ptr) - off)};
+
+			// bits before ptr are not ours
+			auto mask {match(_mm_load_si128(blk)) >> off};
+
+			if (mask != 0)
+			{
+				return ptr + std::countr_zero(mask) / sizeof(T);
+			}
+			for (++blk; (mask = match(_mm_load_si128(blk))) == 0; ++blk);
+
+			return reinterpret_cast<const T*>(blk) + std::countr_zero(mask) / sizeof(T);
+		}
+
+		// lane-wise ==, by unit width
+		template
+		<
+			typename T
+		>
+		inline /*Ი︵𐑼*/ auto cmpeq(const __m128i lhs, const __m128i rhs) -> __m128i
+		{
+			if constexpr (sizeof(T) == 1) { return _mm_cmpeq_epi8(lhs, rhs); }
+			if constexpr (sizeof(T) == 2) { return _mm_cmpeq_epi16(lhs, rhs); }
+			if constexpr (sizeof(T) == 4) { return _mm_cmpeq_epi32(lhs, rhs); }
+		}
+
+		// broadcast, by unit width
+		template
+		<
+			typename T
+		>
+		inline /*Ი︵𐑼*/ auto set1(const T unit) -> __m128i
+		{
+			if constexpr (sizeof(T) == 1) { return _mm_set1_epi8(static_cast<char>(unit)); }
+			if constexpr (sizeof(T) == 2) { return _mm_set1_epi16(static_cast<short>(unit)); }
+			if constexpr (sizeof(T) == 4) { return _mm_set1_epi32(static_cast<int>(unit)); }
+		}
+#endif
+	}
+
+	// first of [a, b, '\0']
+	template
+	<
+		typename T
+	>
+	inline /*Ი︵𐑼*/ auto find_any(const T* ptr, const std::type_identity_t<T> a, const std::type_identity_t<T> b) -> const T*
+	{
+#if defined(__SSE2__)
+		{
+			const auto A {utils::set1<T>(a)};
+			const auto B {utils::set1<T>(b)};
+			const auto Z {_mm_setzero_si128()};
+
+			return utils::align(ptr, [&](const __m128i vec) -> uint32_t
+			{
+				return _mm_movemask_epi8
+				(
+					_mm_or_si128
+					(
+						_mm_or_si128(utils::cmpeq<T>(vec, A), utils::cmpeq<T>(vec, B)),
+						utils::cmpeq<T>(vec, Z)
+					)
+				);
+			});
+		}
+#else
+		for (; *ptr != a && *ptr != b && *ptr != 0; ++ptr);
+
+		return ptr;
+#endif
+	}
+
+	// first of [^ \t\n]
+	template
+	<
+		typename T
+	>
+	inline /*Ი︵𐑼*/ auto skip_blank(const T* ptr) -> const T*
+	{
+#if defined(__SSE2__)
+		{
+			const auto S {utils::set1<T>(' ')};
+			const auto H {utils::set1<T>('\t')};
+			const auto N {utils::set1<T>('\n')};
+
+			return utils::align(ptr, [&](const __m128i vec) -> uint32_t
+			{
+				return ~_mm_movemask_epi8
+				(
+					_mm_or_si128
+					(
+						_mm_or_si128(utils::cmpeq<T>(vec, S), utils::cmpeq<T>(vec, H)),
+						utils::cmpeq<T>(vec, N)
+					)
+				)
+				& 0xFFFF;
+			});
+		}
+#else
+		for (; *ptr == ' ' || *ptr == '\t' || *ptr == '\n'; ++ptr);
+
+		return ptr;
+#endif
+	}
+
+	// first of [^0-9A-Za-z_]; ASCII XID_Continue
+	template
+	<
+		typename T
+	>
+	inline /*Ი︵𐑼*/ auto skip_word(const T* ptr) -> const T*
+	{
+#if defined(__SSE2__)
+		{
+			// x in [lo, hi], as signed lanes
+			const auto in {[](const __m128i vec, const T lo, const T hi)
+			{
+				if constexpr (sizeof(T) == 1)
+				{
+					return _mm_and_si128(_mm_cmpgt_epi8(vec, utils::set1<T>(lo - 1)), _mm_cmplt_epi8(vec, utils::set1<T>(hi + 1)));
+				}
+				if constexpr (sizeof(T) == 2)
+				{
+					return _mm_and_si128(_mm_cmpgt_epi16(vec, utils::set1<T>(lo - 1)), _mm_cmplt_epi16(vec, utils::set1<T>(hi + 1)));
+				}
+				if constexpr (sizeof(T) == 4)
+				{
+					return _mm_and_si128(_mm_cmpgt_epi32(vec, utils::set1<T>(lo - 1)), _mm_cmplt_epi32(vec, utils::set1<T>(hi + 1)));
+				}
+			}};
+
+			const auto U {utils::set1<T>('_')};
+			// 'A' | 0x20 == 'a'
+			const auto L {utils::set1<T>(0x20)};
+
+			return utils::align(ptr, [&](const __m128i vec) -> uint32_t
+			{
+				return ~_mm_movemask_epi8
+				(
+					_mm_or_si128
+					(
+						_mm_or_si128(in(_mm_or_si128(vec, L), 'a', 'z'), in(vec, '0', '9')),
+						utils::cmpeq<T>(vec, U)
+					)
+				)
+				& 0xFFFF;
+			});
+		}
+#else
+		for (; ('0' <= *ptr && *ptr <= '9') || ('a' <= (*ptr | 0x20) && (*ptr | 0x20) <= 'z') || *ptr == '_'; ++ptr);
+
+		return ptr;
+#endif
+	}
+
+	// # of code points in [head, tail)
+	template
+	<
+		typename T
+	>
+	inline /*Ი︵𐑼*/ auto points(const T* head, const T* tail) -> size_t
+	{
+		size_t out {0};
+
+		if constexpr (sizeof(T) == 1)
+		{
+#if defined(__SSE2__)
+			// 10xxxxxx < 11xxxxxx < 0xxxxxxx, as signed
+			const auto C {_mm_set1_epi8(static_cast<char>(0xBF))};
+
+			for (; 16 <= tail - head; head += 16)
+			{
+				const auto vec {_mm_loadu_si128(reinterpret_cast<const __m128i*>(head))};
+
+				out += std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(vec, C))));
+			}
+#endif
+			for (; head < tail; ++head)
+			{
+				out += (*head & 0xC0) != 0x80;
+			}
+		}
+		if constexpr (sizeof(T) == 2)
+		{
+			for (; head < tail; ++head)
+			{
+				out += (*head & 0xFC00) != 0xDC00;
+			}
+		}
+		if constexpr (sizeof(T) == 4)
+		{
+			out += tail - head;
+		}
+		return out;
+	}
+}
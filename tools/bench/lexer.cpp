@@ -0,0 +1,240 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <variant>
+#include <algorithm>
+#include <string_view>
+
+#include "core/fs.hpp"
+
+#include "lang/lexer.hpp"
+
+#include "../impl/corpus.hpp"
+
+//|----------------------------------------------|
+//| lexer throughput on a synthetic corpus.      |
+//|                                              |
+//| bench_lexer [--size=MiB] [--encoding=utf8]   |
+//|             [--rounds=N] [--seed=N]          |
+//|             [--mix=ident:30,comment:6,...]   |
+//|             [--dump=path]                    |
+//|                                              |
+//| numbers are only meaningful in an optimized  |
+//| build, e.g. -DCMAKE_BUILD_TYPE=Release.      |
+//|----------------------------------------------|
+
+namespace // private
+{
+	struct options
+	{
+		double size {16};
+		int rounds {5};
+		uint64_t seed {0x6D6F65};
+		std::string encoding {"utf8"};
+		std::string dump {};
+		corpus::mix mix {corpus::DEFAULT};
+	};
+
+	inline /*Ი︵𐑼*/ auto usage() -> int
+	{
+		std::fprintf(stderr, "usage: bench_lexer [--size=MiB] [--encoding=utf8|utf16|utf32] [--rounds=N] [--seed=N] [--mix=kind:weight,...] [--dump=path]\n");
+		std::fprintf(stderr, "kinds:");
+
+		for (const auto* name : corpus::NAMES)
+		{
+			std::fprintf(stderr, " %s", name);
+		}
+		std::fprintf(stderr, "\n");
+
+		return 1;
+	}
+
+	inline /*Ი︵𐑼*/ auto parse_mix(std::string_view arg, corpus::mix& mix) -> bool
+	{
+		mix.fill(0);
+
+		while (!arg.empty())
+		{
+			const auto end {std::min(arg.find(','), arg.size())};
+			const auto pair {arg.substr(0, end)};
+			const auto sep {pair.find(':')};
+
+			if (sep == std::string_view::npos)
+			{
+				return false;
+			}
+
+			const auto it
+			{
+				std::ranges::find(corpus::NAMES, pair.substr(0, sep))
+			};
+
+			if (it == std::end(corpus::NAMES))
+			{
+				return false;
+			}
+			mix[it - std::begin(corpus::NAMES)] = std::atoi(std::string {pair.substr(sep + 1)}.c_str());
+
+			arg.remove_prefix(std::min(end + 1, arg.size()));
+		}
+		return std::ranges::any_of(mix, [](const auto weight) { return weight != 0; });
+	}
+
+	template
+	<
+		typename T
+	>
+	// with BOM, little endian
+	inline /*Ი︵𐑼*/ auto dump(const std::string& path, const text<T>& data)
+	{
+		if (std::ofstream ofs {path, std::ios::binary})
+		{
+			if constexpr (sizeof(T) == 2)
+			{
+				ofs.write("\xFF\xFE", 2);
+			}
+			if constexpr (sizeof(T) == 4)
+			{
+				ofs.write("\xFF\xFE\x00\x00", 4);
+			}
+			ofs.write(reinterpret_cast<const char*>(data.c_str()), data.size() * sizeof(T));
+
+			std::printf("[✓] '%s'\n", path.c_str());
+		}
+	}
+
+	template
+	<
+		typename T
+	>
+	inline /*Ი︵𐑼*/ auto run(const options& opt)
+	{
+		corpus::generator gen {opt.mix, opt.seed};
+
+		fs::file<utf8, text<T>>
+		file
+		{
+			utf8 {u8"<bench>"},
+			gen.template make<T>(static_cast<size_t>(opt.size * (1 << 20)))
+		};
+
+		if (!opt.dump.empty())
+		{
+			dump(opt.dump, file.data);
+		}
+
+		const auto bytes {file.data.size() * sizeof(T)};
+
+		size_t tokens {0};
+		size_t errors {0};
+
+		std::vector<double> times;
+
+		for (int i {0}; i < opt.rounds; ++i)
+		{
+			tokens = 0;
+			errors = 0;
+
+			const auto t0 {std::chrono::steady_clock::now()};
+
+			lexer<utf8, text<T>> lexer {&file};
+
+			while (true)
+			{
+				const auto out {lexer.pull()};
+
+				if (std::holds_alternative<eof>(out))
+				{
+					break;
+				}
+				++(std::holds_alternative<error<utf8, text<T>>>(out) ? errors : tokens);
+			}
+
+			const auto t1 {std::chrono::steady_clock::now()};
+
+			times.emplace_back(std::chrono::duration<double>(t1 - t0).count());
+		}
+
+		std::ranges::sort(times);
+
+		const auto best {times.front()};
+		const auto median {times[times.size() / 2]};
+
+		std::printf("encoding : %s\n", opt.encoding.c_str());
+		std::printf("size     : %.2f MiB (%zu code units)\n", bytes / double(1 << 20), file.data.size());
+		std::printf("tokens   : %zu (+%zu errors)\n", tokens, errors);
+		std::printf("best     : %8.2f ms  %8.1f MB/s  %8.2f M tokens/s\n", best * 1e3, bytes / best / 1e6, (tokens + errors) / best / 1e6);
+		std::printf("median   : %8.2f ms  %8.1f MB/s  %8.2f M tokens/s\n", median * 1e3, bytes / median / 1e6, (tokens + errors) / median / 1e6);
+	}
+}
+
+auto main(int argc, char** argv) -> int
+{
+	options opt;
+
+	for (int i {1}; i < argc; ++i)
+	{
+		const std::string_view arg {argv[i]};
+
+		const auto value {arg.substr(std::min(arg.find('=') + 1, arg.size()))};
+
+		if (arg.starts_with("--size="))
+		{
+			opt.size = std::atof(value.data());
+		}
+		else if (arg.starts_with("--rounds="))
+		{
+			opt.rounds = std::atoi(value.data());
+		}
+		else if (arg.starts_with("--seed="))
+		{
+			opt.seed = std::strtoull(value.data(), nullptr, 0);
+		}
+		else if (arg.starts_with("--encoding="))
+		{
+			opt.encoding = value;
+		}
+		else if (arg.starts_with("--dump="))
+		{
+			opt.dump = value;
+		}
+		else if (arg.starts_with("--mix="))
+		{
+			if (!parse_mix(value, opt.mix))
+			{
+				return usage();
+			}
+		}
+		else
+		{
+			return usage();
+		}
+	}
+
+	if (opt.size <= 0 || opt.rounds <= 0)
+	{
+		return usage();
+	}
+
+	if (opt.encoding == "utf8")
+	{
+		run<char8_t>(opt);
+	}
+	else if (opt.encoding == "utf16")
+	{
+		run<char16_t>(opt);
+	}
+	else if (opt.encoding == "utf32")
+	{
+		run<char32_t>(opt);
+	}
+	else
+	{
+		return usage();
+	}
+	return 0;
+}
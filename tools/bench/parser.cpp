@@ -0,0 +1,171 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <algorithm>
+#include <string_view>
+
+#include "core/fs.hpp"
+
+#include "lang/lexer.hpp"
+#include "lang/parser.hpp"
+
+#include "../impl/corpus.hpp"
+
+//|----------------------------------------------|
+//| parser throughput under error recovery.      |
+//|                                              |
+//| bench_parser [--size=MiB] [--errors=0..1]    |
+//|              [--rounds=N] [--seed=N]         |
+//|              [--jobs=N] [--lazy]             |
+//|              [--dump=path]                   |
+//|                                              |
+//| --errors is the share of lines that carry a  |
+//| syntax error; 1 means one error per line.    |
+//| with --jobs or --lazy, the file is tokenized |
+//| up front & only parser::pull(jobs) is timed. |
+//| --lazy skips fun bodies, which are left to   |
+//| AST::wake; so are their errors.              |
+//|----------------------------------------------|
+
+namespace // private
+{
+	struct options
+	{
+		double size {4};
+		double errors {1};
+		int rounds {5};
+		// 0: streaming
+		size_t jobs {0};
+		bool lazy {false};
+		uint64_t seed {0x6D6F65};
+		std::string dump {};
+	};
+
+	inline /*Ი︵𐑼*/ auto usage() -> int
+	{
+		std::fprintf(stderr, "usage: bench_parser [--size=MiB] [--errors=0..1] [--rounds=N] [--seed=N] [--jobs=N] [--lazy] [--dump=path]\n");
+
+		return 1;
+	}
+
+	inline /*Ი︵𐑼*/ auto run(const options& opt)
+	{
+		corpus::generator gen {corpus::DEFAULT, opt.seed};
+
+		fs::file<utf8, utf8>
+		file
+		{
+			utf8 {u8"<bench>"},
+			corpus::generator::encode<char8_t>(gen.lines(static_cast<size_t>(opt.size * (1 << 20)), opt.errors))
+		};
+
+		if (!opt.dump.empty())
+		{
+			if (std::ofstream ofs {opt.dump, std::ios::binary})
+			{
+				ofs.write(reinterpret_cast<const char*>(file.data.c_str()), file.data.size());
+			}
+		}
+
+		const auto bytes {file.data.size()};
+		const auto lines {static_cast<size_t>(std::ranges::count(file.data.c_str(), file.data.c_str() + bytes, u8'\n'))};
+
+		size_t errors {0};
+
+		std::vector<double> times;
+
+		const auto tape
+		{
+			lexer<utf8, utf8> {&file}.tokenize_all()
+		};
+
+		for (int i {0}; i < opt.rounds; ++i)
+		{
+			const auto t0 {std::chrono::steady_clock::now()};
+
+			if (opt.jobs == 0 && !opt.lazy)
+			{
+				lexer<utf8, utf8> lexer {&file};
+				parser<utf8, utf8> parser {&lexer};
+
+				errors = parser.pull().lint.size();
+			}
+			else
+			{
+				parser<utf8, utf8> parser {&tape, opt.lazy};
+
+				errors = parser.pull(opt.jobs).lint.size();
+			}
+
+			const auto t1 {std::chrono::steady_clock::now()};
+
+			times.emplace_back(std::chrono::duration<double>(t1 - t0).count());
+		}
+
+		std::ranges::sort(times);
+
+		const auto best {times.front()};
+		const auto median {times[times.size() / 2]};
+
+		std::printf("size     : %.2f MiB (%zu lines)\n", bytes / double(1 << 20), lines);
+		std::printf("errors   : %zu reported\n", errors);
+		std::printf("best     : %8.2f ms  %8.1f MB/s  %8.2f M lines/s\n", best * 1e3, bytes / best / 1e6, lines / best / 1e6);
+		std::printf("median   : %8.2f ms  %8.1f MB/s  %8.2f M lines/s\n", median * 1e3, bytes / median / 1e6, lines / median / 1e6);
+	}
+}
+
+auto main(int argc, char** argv) -> int
+{
+	options opt;
+
+	for (int i {1}; i < argc; ++i)
+	{
+		const std::string_view arg {argv[i]};
+
+		const auto value {arg.substr(std::min(arg.find('=') + 1, arg.size()))};
+
+		if (arg.starts_with("--size="))
+		{
+			opt.size = std::atof(value.data());
+		}
+		else if (arg.starts_with("--errors="))
+		{
+			opt.errors = std::atof(value.data());
+		}
+		else if (arg.starts_with("--rounds="))
+		{
+			opt.rounds = std::atoi(value.data());
+		}
+		else if (arg.starts_with("--jobs="))
+		{
+			opt.jobs = std::strtoull(value.data(), nullptr, 0);
+		}
+		else if (arg == "--lazy")
+		{
+			opt.lazy = true;
+		}
+		else if (arg.starts_with("--seed="))
+		{
+			opt.seed = std::strtoull(value.data(), nullptr, 0);
+		}
+		else if (arg.starts_with("--dump="))
+		{
+			opt.dump = value;
+		}
+		else
+		{
+			return usage();
+		}
+	}
+
+	if (opt.size <= 0 || opt.rounds <= 0 || opt.errors < 0 || 1 < opt.errors)
+	{
+		return usage();
+	}
+	run(opt);
+
+	return 0;
+}
@@ -0,0 +1,121 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <algorithm>
+
+#include "core/fs.hpp"
+
+#include "lang/lexer.hpp"
+#include "lang/parser.hpp"
+
+#include "lang/common/flat.hpp"
+
+#include "../impl/corpus.hpp"
+
+//|----------------------------------------------|
+//| .moeast files that lie are turned down.      |
+//|                                              |
+//| a parsed corpus is saved & loaded back as is |
+//| first; then bytes past the header are        |
+//| flipped, or the file is cut short & padded.  |
+//| whatever flat::load still accepts must come  |
+//| back through flat::into in one piece, which  |
+//| the sanitizers of a debug build watch over.  |
+//|----------------------------------------------|
+
+namespace // private
+{
+	constexpr const size_t MUTATIONS {4000};
+	constexpr const uint64_t HASH {0x6D6F65};
+
+	inline /*Ი︵𐑼*/ auto bytes(const std::string& str) -> std::span<const std::byte>
+	{
+		return {reinterpret_cast<const std::byte*>(str.data()), str.size()};
+	}
+
+	inline /*Ი︵𐑼*/ auto save(const flat& ast) -> std::string
+	{
+		std::ostringstream out;
+
+		ast.save(out, HASH);
+
+		return out.str();
+	}
+}
+
+auto main() -> int
+{
+	corpus::generator gen {corpus::DEFAULT, 0x666C6174};
+
+	fs::file<utf8, utf8> file {utf8 {u8"<flat>"}, corpus::generator::encode<char8_t>(gen.lines(1 << 14, 0))};
+
+	lexer<utf8, utf8> lexer {&file};
+	parser<utf8, utf8> parser {&lexer};
+
+	const auto exe {parser.pull()};
+
+	const auto good {save(*flat::from(exe))};
+
+	// step 1. as is
+	{
+		const auto ast {flat::load(bytes(good), HASH)};
+
+		if (!ast || save(*ast) != good)
+		{
+			std::fprintf(stderr, "flat: round trip failed\n");
+
+			return 1;
+		}
+		if (flat::load(bytes(good), HASH + 1))
+		{
+			std::fprintf(stderr, "flat: stale hash accepted\n");
+
+			return 1;
+		}
+	}
+
+	// step 2. corrupted
+	std::mt19937_64 rng {0x6D6F65};
+
+	size_t taken {0};
+
+	for (size_t i {0}; i < MUTATIONS; ++i)
+	{
+		auto data {good};
+
+		// past magic, version, layout & hash
+		const size_t head {24};
+
+		if (i % 8 == 0)
+		{
+			// truncated, then padded back
+			const auto cut {head + rng() % (data.size() - head)};
+
+			std::fill(data.begin() + cut, data.end(), static_cast<char>(rng()));
+		}
+		else
+		{
+			for (auto n {1 + rng() % 4}; n; --n)
+			{
+				data[head + rng() % (data.size() - head)] ^= static_cast<char>(1 + rng() % 255);
+			}
+		}
+
+		if (const auto ast {flat::load(bytes(data), HASH)})
+		{
+			AST<utf8, utf8> out;
+
+			ast->into(out);
+
+			taken += flat::from(out)->size() == ast->size();
+		}
+	}
+
+	std::printf("flat: ok (%zu of %zu mutations loaded)\n", taken, MUTATIONS);
+
+	return 0;
+}
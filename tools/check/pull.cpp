@@ -0,0 +1,317 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <sstream>
+#include <algorithm>
+
+#include "core/fs.hpp"
+
+#include "lang/lexer.hpp"
+#include "lang/parser.hpp"
+
+#include "lang/common/flat.hpp"
+
+#include "../impl/corpus.hpp"
+
+//|----------------------------------------------|
+//| parser::pull(jobs) agrees with pull(), and   |
+//| a lazy pull(jobs), once woken, with both.    |
+//|                                              |
+//| on clean input, node for node. past an error |
+//| each recovers in its own way, as a chunk     |
+//| ends in an eof of its own; still, the first  |
+//| diagnostic is the same, no place is reported |
+//| twice, and the hand-picked cases below are   |
+//| reported exactly as listed. a woken body     |
+//| stops at its first fatal error, where eager  |
+//| parsing goes on at the top level; so its     |
+//| diagnostics are a subset, and the funs that  |
+//| woke up fine are those eager parsing kept.   |
+//|----------------------------------------------|
+
+namespace // private
+{
+	constexpr const size_t FILES {64};
+	constexpr const size_t JOBS {4};
+
+	struct sample
+	{
+		const char8_t* text;
+		// diagnostics of pull() & pull(jobs)
+		const char* pull;
+		const char* jobs;
+	};
+
+	const sample CASES[]
+	{
+		// a missing ';' before a '}'
+		{
+			u8"fun! f(): i32\n{\n\tlet a: i32 = 1\n}\n\nfun! g(): i32\n{\n\tlet b: i32 = 2;\n}\n",
+			"32:1 expects ';'\n68:1 expects '}'\n",
+			"32:1 expects ';'\n",
+		},
+		{
+			u8"fun! f(): i32\n{\n\t1 + 2\n}\n",
+			"23:1 expects ';'\n",
+			"23:1 expects ';'\n",
+		},
+		// cut short
+		{
+			u8"fun! f(): i32\n{\n\tlet a: i32 = 1;",
+			"31:1 expects '}'\n",
+			"31:1 expects '}'\n",
+		},
+		{
+			u8"let a: i32 =",
+			"11:1 invalid expr\n",
+			"11:1 invalid expr\n",
+		},
+	};
+
+	using file = fs::file<utf8, utf8>;
+
+	// one line each
+	inline /*Ი︵𐑼*/ auto lint(const AST<utf8, utf8>& exe) -> std::vector<std::string>
+	{
+		std::vector<std::string> out;
+
+		for (const auto& lint : exe.lint)
+		{
+			std::ostringstream str;
+
+			str << lint.offset << ':' << lint.length << ' ' << std::string {lint.msg.c_str(), lint.msg.c_str() + lint.msg.size()} << '\n';
+
+			out.emplace_back(str.str());
+		}
+		return out;
+	}
+
+	inline /*Ი︵𐑼*/ auto join(const std::vector<std::string>& list) -> std::string
+	{
+		std::string out;
+
+		for (const auto& it : list)
+		{
+			out += it;
+		}
+		return out;
+	}
+
+	inline /*Ი︵𐑼*/ auto dump(const AST<utf8, utf8>& exe) -> std::string
+	{
+		std::ostringstream out;
+
+		out << join(lint(exe));
+
+		flat::from(exe)->save(out, 0);
+
+		return out.str();
+	}
+
+	// no offset twice
+	inline /*Ი︵𐑼*/ auto once(const AST<utf8, utf8>& exe) -> bool
+	{
+		std::vector<uint32_t> list;
+
+		for (const auto& lint : exe.lint)
+		{
+			list.emplace_back(lint.offset);
+		}
+		std::ranges::sort(list);
+
+		return std::ranges::adjacent_find(list) == list.end();
+	}
+
+	// by place, as woken bodies report last
+	inline /*Ი︵𐑼*/ auto first(const AST<utf8, utf8>& exe) -> std::string
+	{
+		const auto it {std::ranges::min_element(exe.lint, {}, [](const auto& lint) { return lint.offset; })};
+
+		return it == exe.lint.end() ? std::string {} : lint(exe)[it - exe.lint.begin()];
+	}
+
+	// every lazy body under node, nested ones too
+	template
+	<
+		typename N
+	>
+	inline /*Ი︵𐑼*/ auto wake(AST<utf8, utf8>& exe, const N& node) -> void
+	{
+		if constexpr (!std::is_pointer_v<N>)
+		{
+			std::visit([&](auto* ptr)
+			{
+				if (ptr)
+				{
+					wake(exe, ptr);
+				}
+			},
+			node);
+		}
+		else
+		{
+			typedef std::remove_cvref_t<decltype(*node)> T;
+
+			if constexpr (std::is_same_v<T, fun_decl>)
+			{
+				exe.wake(exe, node);
+			}
+			if constexpr (std::is_same_v<T, fun_decl> || std::is_same_v<T, block_stmt>)
+			{
+				for (const auto& it : node->body)
+				{
+					wake(exe, it);
+				}
+			}
+			if constexpr (std::is_same_v<T, if_stmt> || std::is_same_v<T, match_stmt>)
+			{
+				for (const auto& flow : node->body)
+				{
+					wake(exe, flow.then);
+				}
+			}
+			if constexpr (std::is_same_v<T, for_stmt> || std::is_same_v<T, while_stmt>)
+			{
+				wake(exe, node->body);
+			}
+		}
+	}
+
+	// lazily, then woken; top-level funs whose body failed go to drop
+	inline /*Ი︵𐑼*/ auto woken(const tape<utf8, utf8>& tape, std::vector<const fun_decl*>& drop) -> AST<utf8, utf8>
+	{
+		auto out {parser<utf8, utf8> {&tape, true}.pull(JOBS)};
+
+		for (const auto& node : out.body)
+		{
+			if (const auto ptr {std::get_if<fun_decl*>(&node)}; ptr && !out.wake(out, *ptr))
+			{
+				drop.emplace_back(*ptr);
+			}
+			wake(out, node);
+		}
+		return out;
+	}
+
+	// top-level funs only, but those in drop
+	inline /*Ი︵𐑼*/ auto funs(const AST<utf8, utf8>& exe, const std::vector<const fun_decl*>& drop) -> std::string
+	{
+		AST<utf8, utf8> tmp;
+
+		for (const auto& node : exe.body)
+		{
+			if (const auto ptr {std::get_if<fun_decl*>(&node)}; ptr && std::ranges::find(drop, *ptr) == drop.end())
+			{
+				tmp.body.emplace_back(tmp.pool, *ptr);
+			}
+		}
+		std::ostringstream out;
+
+		flat::from(tmp)->save(out, 0);
+
+		return out.str();
+	}
+
+	// lhs within rhs, duplicates included
+	inline /*Ი︵𐑼*/ auto within(std::vector<std::string> lhs, std::vector<std::string> rhs) -> bool
+	{
+		std::ranges::sort(lhs);
+		std::ranges::sort(rhs);
+
+		return std::ranges::includes(rhs, lhs);
+	}
+}
+
+auto main() -> int
+{
+	size_t bad {0};
+	size_t all {0};
+
+	const auto report {[&](const char* what, const size_t nth)
+	{
+		if (bad++ < 8)
+		{
+			std::fprintf(stderr, "mismatch: %s #%zu\n", what, nth);
+		}
+	}};
+
+	// step 1. by hand
+	for (size_t i {0}; i < std::size(CASES); ++i, ++all)
+	{
+		file src {utf8 {u8"<case>"}, utf8 {CASES[i].text}};
+
+		const auto tape {lexer<utf8, utf8> {&src}.tokenize_all()};
+
+		lexer<utf8, utf8> stream {&src};
+
+		if (join(lint(parser<utf8, utf8> {&stream}.pull())) != CASES[i].pull)
+		{
+			report("pull() of case", i);
+		}
+		if (join(lint(parser<utf8, utf8> {&tape}.pull(JOBS))) != CASES[i].jobs)
+		{
+			report("pull(jobs) of case", i);
+		}
+		std::vector<const fun_decl*> drop;
+
+		if (join(lint(woken(tape, drop))) != CASES[i].jobs)
+		{
+			report("lazy pull(jobs) of case", i);
+		}
+	}
+
+	// step 2. at random, clean & broken
+	std::mt19937_64 rng {0x6D6F65};
+
+	for (const auto rate : {0.0, 0.05})
+	{
+		corpus::generator gen {corpus::DEFAULT, rng()};
+
+		for (size_t i {0}; i < FILES; ++i, ++all)
+		{
+			const auto utf {corpus::generator::encode<char8_t>(gen.lines(1 << 12, rate))};
+
+			file src {utf8 {u8"<corpus>"}, utf8 {utf.c_str()}};
+
+			const auto tape {lexer<utf8, utf8> {&src}.tokenize_all()};
+
+			lexer<utf8, utf8> stream {&src};
+
+			const auto lhs {parser<utf8, utf8> {&stream}.pull()};
+			const auto rhs {parser<utf8, utf8> {&tape}.pull(JOBS)};
+
+			std::vector<const fun_decl*> drop;
+
+			const auto lazy {woken(tape, drop)};
+
+			if (lhs.lint.empty())
+			{
+				if (dump(lhs) != dump(rhs) || dump(lazy) != dump(rhs))
+				{
+					report("clean file", i);
+				}
+				continue;
+			}
+			if (rhs.lint.empty() || lint(lhs)[0] != lint(rhs)[0] || !once(lhs) || !once(rhs))
+			{
+				report("broken file", i);
+			}
+			if (funs(lazy, drop) != funs(rhs, {}) || !within(lint(lazy), lint(rhs)) || first(lazy) != first(rhs) || !once(lazy))
+			{
+				report("broken file, lazily", i);
+			}
+		}
+	}
+
+	if (bad == 0)
+	{
+		std::printf("pull: ok\n");
+	}
+	else
+	{
+		std::fprintf(stderr, "pull: %zu of %zu inputs differ\n", bad, all);
+	}
+	return bad == 0 ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+
+#include "core/fs.hpp"
+
+#include "lang/lexer.hpp"
+
+#include "../impl/corpus.hpp"
+
+//|----------------------------------------------|
+//| lexer::relex agrees with a full tokenize.    |
+//|                                              |
+//| hand-picked edits next to the lexer's        |
+//| lookahead come first, then random splices of |
+//| short snippets into a synthetic corpus; each |
+//| re-lexed tape must equal the one lexed from  |
+//| scratch, token by token & error by error.    |
+//|----------------------------------------------|
+
+namespace // private
+{
+	constexpr const size_t EDITS {1000};
+
+	// mostly numbers & marks, for '.' after digits
+	constexpr const corpus::mix DENSE {10, 0, 30, 60, 0, 0, 0};
+
+	struct edit
+	{
+		std::u8string text;
+		// [head, tail) of text
+		uint32_t head;
+		uint32_t tail;
+		// replaced with
+		std::u8string with;
+	};
+
+	const edit CASES[]
+	{
+		{u8"1.x", 2, 3, u8"5"},
+		{u8"1.5", 2, 3, u8"x"},
+		{u8"a = 1.x + 2;", 6, 7, u8"5"},
+		{u8"a = 1.5 + 2;", 6, 7, u8"y"},
+		{u8"1 .5", 1, 2, u8""},
+		{u8"1. 5", 2, 3, u8""},
+		{u8"x | y", 2, 3, u8"||"},
+		{u8"x |  y", 3, 4, u8"|"},
+		{u8"a / b", 3, 3, u8"*"},
+		{u8"fun x", 3, 3, u8"!"},
+		{u8"@stati x", 6, 6, u8"c"},
+		{u8"@inlin", 6, 6, u8"e"},
+		{u8"a = @stati;", 10, 10, u8"c"},
+	};
+
+	// spliced in at random
+	const char8_t* SNIPPETS[]
+	{
+		u8"", u8" ", u8"\n", u8"1", u8"5", u8".", u8".5", u8"x", u8"_",
+		u8"/", u8"*", u8"/*", u8"*/", u8"//", u8"\"", u8"|", u8"?", u8"!",
+		u8"=", u8"fun", u8"let", u8"∅", u8"@", u8"@stati", u8"c",
+	};
+
+	using file = fs::file<utf8, utf8>;
+
+	inline /*Ი︵𐑼*/ auto same(const tape<utf8, utf8>& lhs, const tape<utf8, utf8>& rhs) -> bool
+	{
+		if (lhs.type != rhs.type || lhs.offset != rhs.offset || lhs.length != rhs.length || lhs.value != rhs.value)
+		{
+			return false;
+		}
+		return std::ranges::equal(lhs.lint, rhs.lint, [](const auto& a, const auto& b)
+		{
+			return a.first == b.first && a.second.offset == b.second.offset && a.second.length == b.second.length && a.second.msg == b.second.msg;
+		});
+	}
+
+	inline /*Ი︵𐑼*/ auto check(const edit& it) -> bool
+	{
+		file before {utf8 {u8"<before>"}, utf8 {it.text.c_str()}};
+
+		const auto old {lexer<utf8, utf8> {&before}.tokenize_all()};
+
+		const auto text {it.text.substr(0, it.head) + it.with + it.text.substr(it.tail)};
+
+		file after {utf8 {u8"<after>"}, utf8 {text.c_str()}};
+
+		const auto now {lexer<utf8, utf8> {&after}.relex(old, it.head, it.tail, static_cast<uint32_t>(it.with.size()))};
+
+		return same(now, lexer<utf8, utf8> {&after}.tokenize_all());
+	}
+}
+
+auto main() -> int
+{
+	size_t bad {0};
+
+	const auto report {[&](const edit& it)
+	{
+		if (bad++ < 8)
+		{
+			std::fprintf(stderr, "mismatch: [%u, %u) of \"%.40s\" -> \"%s\"\n", it.head, it.tail, reinterpret_cast<const char*>(it.text.c_str() + std::min<size_t>(it.head, it.text.size()) - std::min<size_t>(it.head, 8)), reinterpret_cast<const char*>(it.with.c_str()));
+		}
+	}};
+
+	// step 1. by hand
+	for (const auto& it : CASES)
+	{
+		if (!check(it))
+		{
+			report(it);
+		}
+	}
+
+	// step 2. at random
+	std::mt19937_64 rng {0x6D6F65};
+
+	for (const auto& mix : {corpus::DEFAULT, DENSE})
+	{
+		corpus::generator gen {mix, rng()};
+
+		const auto utf {corpus::generator::encode<char8_t>(gen.make(1 << 14))};
+
+		const std::u8string text {utf.c_str(), utf.size()};
+
+		// on a code point
+		const auto align {[&](uint32_t at)
+		{
+			for (; 0 < at && at < text.size() && (text[at] & 0xC0) == 0x80; --at);
+
+			return at;
+		}};
+
+		for (size_t i {0}; i < EDITS; ++i)
+		{
+			const auto head {align(static_cast<uint32_t>(rng() % (text.size() + 1)))};
+			const auto tail {align(static_cast<uint32_t>(std::min<size_t>(head + rng() % 4, text.size())))};
+
+			const edit it {text, head, std::max(head, tail), SNIPPETS[rng() % std::size(SNIPPETS)]};
+
+			if (!check(it))
+			{
+				report(it);
+			}
+		}
+	}
+
+	if (bad == 0)
+	{
+		std::printf("relex: ok\n");
+	}
+	else
+	{
+		std::fprintf(stderr, "relex: %zu of %zu edits differ\n", bad, std::size(CASES) + 2 * EDITS);
+	}
+	return bad == 0 ? 0 : 1;
+}
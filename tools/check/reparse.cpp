@@ -0,0 +1,166 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+
+#include "core/fs.hpp"
+
+#include "lang/lexer.hpp"
+#include "lang/parser.hpp"
+
+#include "lang/common/flat.hpp"
+
+#include "../impl/corpus.hpp"
+
+//|----------------------------------------------|
+//| incremental parser::pull agrees with a full  |
+//| parse, on the tape lexer::relex produces.    |
+//| both recover from errors within a top-level  |
+//| chunk, so the full parse is pull(jobs).      |
+//|                                              |
+//| edits next to numbers & marks come first,    |
+//| then random splices into parsable functions; |
+//| nodes are compared through flat::save, and   |
+//| diagnostics by place & message.              |
+//|----------------------------------------------|
+
+namespace // private
+{
+	constexpr const size_t EDITS {1000};
+	constexpr const size_t JOBS {2};
+
+	struct edit
+	{
+		std::u8string text;
+		// [head, tail) of text
+		uint32_t head;
+		uint32_t tail;
+		// replaced with
+		std::u8string with;
+	};
+
+	constexpr const char8_t SOURCE[]
+	{
+		u8"fun! f(): i32\n{\n\tlet a: i32 = 1.x + 2;\n}\n\n"
+		u8"fun! g(): i32\n{\n\tlet b: f64 = 1.5;\n}\n\n"
+		u8"let c: i32 = 3;\n"
+		u8"let d: i32 = @stati;\n"
+	};
+
+	const edit CASES[]
+	{
+		// 1.x -> 1.5
+		{SOURCE, 32, 33, u8"5"},
+		// 1.5 -> 1.x
+		{SOURCE, 74, 75, u8"x"},
+		// 1.x -> 1 .x
+		{SOURCE, 31, 31, u8" "},
+		// 3 -> 4.2
+		{SOURCE, 93, 94, u8"4.2"},
+		// @stati -> @static
+		{SOURCE, 115, 115, u8"c"},
+	};
+
+	// spliced in at random
+	const char8_t* SNIPPETS[]
+	{
+		u8"", u8" ", u8"\n", u8"1", u8"5", u8".", u8"x", u8";", u8"{", u8"}",
+		u8"(", u8")", u8"/*", u8"\"", u8"@", u8"@stati", u8"c",
+		u8"let q: i32 = 1;", u8"fun! z(): i32 { }",
+	};
+
+	using file = fs::file<utf8, utf8>;
+
+	inline /*Ი︵𐑼*/ auto dump(const AST<utf8, utf8>& exe) -> std::string
+	{
+		std::ostringstream out;
+
+		for (const auto& lint : exe.lint)
+		{
+			out << lint.offset << ':' << lint.length << ' ' << std::string {lint.msg.c_str(), lint.msg.c_str() + lint.msg.size()} << '\n';
+		}
+		flat::from(exe)->save(out, 0);
+
+		return out.str();
+	}
+
+	inline /*Ი︵𐑼*/ auto check(const edit& it) -> bool
+	{
+		file before {utf8 {u8"<before>"}, utf8 {it.text.c_str()}};
+
+		const auto prev {lexer<utf8, utf8> {&before}.tokenize_all()};
+
+		auto old {parser<utf8, utf8> {&prev}.pull(JOBS)};
+
+		const auto text {it.text.substr(0, it.head) + it.with + it.text.substr(it.tail)};
+
+		file after {utf8 {u8"<after>"}, utf8 {text.c_str()}};
+
+		const auto size {static_cast<uint32_t>(it.with.size())};
+
+		const auto now {lexer<utf8, utf8> {&after}.relex(prev, it.head, it.tail, size)};
+		const auto all {lexer<utf8, utf8> {&after}.tokenize_all()};
+
+		const auto inc {parser<utf8, utf8> {&now}.pull(std::move(old), prev, it.head, it.tail, size)};
+
+		return dump(inc) == dump(parser<utf8, utf8> {&all}.pull(JOBS));
+	}
+}
+
+auto main() -> int
+{
+	size_t bad {0};
+
+	const auto report {[&](const edit& it)
+	{
+		if (bad++ < 8)
+		{
+			std::fprintf(stderr, "mismatch: [%u, %u) -> \"%s\"\n", it.head, it.tail, reinterpret_cast<const char*>(it.with.c_str()));
+		}
+	}};
+
+	// step 1. by hand
+	for (const auto& it : CASES)
+	{
+		if (!check(it))
+		{
+			report(it);
+		}
+	}
+
+	// step 2. at random
+	std::mt19937_64 rng {0x6D6F65};
+
+	corpus::generator gen {corpus::DEFAULT, rng()};
+
+	const auto utf {corpus::generator::encode<char8_t>(gen.lines(1 << 13, 0.05))};
+
+	const std::u8string text {utf.c_str(), utf.size()};
+
+	for (size_t i {0}; i < EDITS; ++i)
+	{
+		const auto head {static_cast<uint32_t>(rng() % (text.size() + 1))};
+		const auto tail {static_cast<uint32_t>(std::min<size_t>(head + rng() % 4, text.size()))};
+
+		const edit it {text, head, tail, SNIPPETS[rng() % std::size(SNIPPETS)]};
+
+		if (!check(it))
+		{
+			report(it);
+		}
+	}
+
+	if (bad == 0)
+	{
+		std::printf("reparse: ok\n");
+	}
+	else
+	{
+		std::fprintf(stderr, "reparse: %zu of %zu edits differ\n", bad, std::size(CASES) + EDITS);
+	}
+	return bad == 0 ? 0 : 1;
+}
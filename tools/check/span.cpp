@@ -0,0 +1,88 @@
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <sstream>
+#include <variant>
+
+#include "core/fs.hpp"
+
+#include "lang/lexer.hpp"
+#include "lang/parser.hpp"
+
+//|----------------------------------------------|
+//| spans past line 65,535 still resolve.        |
+//|                                              |
+//| a file of LINES valid lines ends in a syntax |
+//| error; the last token & the first diagnostic |
+//| are located through fs::file::locate and     |
+//| printed, as main.cpp would.                  |
+//|----------------------------------------------|
+
+namespace // private
+{
+	constexpr const size_t LINES {150'000};
+
+	// 22nd code point, yet not the 22nd code unit
+	constexpr const char8_t TAIL[] {u8"/* ∅ */ let b: i32 = ;\n"};
+}
+
+auto main() -> int
+{
+	std::u8string src;
+
+	for (size_t i {0}; i < LINES; ++i)
+	{
+		src += u8"let a: i32 = 1;\n";
+	}
+	src += TAIL;
+
+	fs::file<utf8, utf8> file {utf8 {u8"<span>"}, utf8 {src.c_str()}};
+
+	bool fine {true};
+
+	// step 1. the last token, by offset
+	{
+		const auto tape {lexer<utf8, utf8> {&file}.tokenize_all()};
+
+		const auto last {tape.offset.back()};
+
+		const auto [line, column] {file.locate(last)};
+
+		if (last <= UINT16_MAX || line != LINES + 1 || column != 22)
+		{
+			std::fprintf(stderr, "token: %u at %zu:%zu, expects %zu:22\n", last, line, column, LINES + 1);
+
+			fine = false;
+		}
+	}
+
+	// step 2. the diagnostic, as rendered
+	{
+		lexer<utf8, utf8> lexer {&file};
+		parser<utf8, utf8> parser {&lexer};
+
+		const auto exe {parser.pull()};
+
+		std::ostringstream out;
+
+		if (!exe.lint.empty())
+		{
+			out << exe.lint.front();
+		}
+
+		const auto expects {"<span>(" + std::to_string(LINES + 1) + ":22)"};
+
+		if (out.str().find(expects) == std::string::npos)
+		{
+			std::fprintf(stderr, "lint: %s\nexpects %s\n", out.str().c_str(), expects.c_str());
+
+			fine = false;
+		}
+	}
+
+	if (fine)
+	{
+		std::printf("span: ok\n");
+	}
+	return fine ? 0 : 1;
+}
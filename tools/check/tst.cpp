@@ -0,0 +1,226 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+
+#include "models/str.hpp"
+#include "models/tst.hpp"
+
+//|----------------------------------------------|
+//| tst stays AVL balanced under insertion.      |
+//|                                              |
+//| keys go in sorted & reverse sorted, which    |
+//| degrade an unbalanced tree into a list; at   |
+//| every level, cached heights must match and   |
+//| no two siblings may differ by more than one. |
+//|                                              |
+//| then longest_match, of the tree & of its     |
+//| freeze(), by hand; and near(), against a     |
+//| brute force Levenshtein over every key.      |
+//|----------------------------------------------|
+
+namespace // private
+{
+	constexpr const uint32_t SIZE {1 << 14};
+	constexpr const uint32_t QUERIES {1 << 10};
+
+	// longest_match & near
+	const std::pair<const char32_t*, uint32_t> WORDS[]
+	{
+		{U"a", 1}, {U"ab", 2}, {U"abc", 3}, {U"abd", 4},
+		{U"b", 5}, {U"bad", 6}, {U"cab", 7}, {U"xyz", 8},
+	};
+
+	struct munch
+	{
+		const char32_t* text;
+		// read no further
+		size_t bound;
+		// (length, value), if any
+		std::optional<std::pair<size_t, uint32_t>> want;
+	};
+
+	const munch MUNCHES[]
+	{
+		// exact
+		{U"abc", 3, {{3, 3}}},
+		{U"xyz", 3, {{3, 8}}},
+		// a key is a prefix of it
+		{U"abq", 3, {{2, 2}}},
+		{U"abcd", 4, {{3, 3}}},
+		{U"bac", 3, {{1, 5}}},
+		// no key is
+		{U"q", 1, {}},
+		{U"xy", 2, {}},
+		{U"", 0, {}},
+		// stops at the bound
+		{U"abc", 2, {{2, 2}}},
+		{U"abc", 1, {{1, 1}}},
+		{U"abc", 0, {}},
+	};
+
+	inline /*Ი︵𐑼*/ auto key(const uint32_t nth, const size_t width) -> utf32
+	{
+		std::u32string out (width - 1, U'k');
+		// never '\0'
+		out += static_cast<char32_t>(nth + 1);
+
+		return utf32 {out.c_str()};
+	}
+
+	inline /*Ი︵𐑼*/ auto check(const char* name, const size_t width, const bool reverse) -> bool
+	{
+		tst<uint32_t> tree {std::vector<std::pair<utf32, uint32_t>> {}};
+
+		for (uint32_t i {0}; i < SIZE; ++i)
+		{
+			const auto nth {reverse ? SIZE - 1 - i : i};
+
+			tree[key(nth, width)] = nth;
+
+			if ((i & (i + 1)) == 0 && !tree.balanced())
+			{
+				std::fprintf(stderr, "%s: unbalanced after %u keys\n", name, i + 1);
+
+				return false;
+			}
+		}
+		if (!tree.balanced())
+		{
+			std::fprintf(stderr, "%s: unbalanced\n", name);
+
+			return false;
+		}
+		for (uint32_t i {0}; i < SIZE; ++i)
+		{
+			if (std::optional<uint32_t> {tree[key(i, width)]} != i)
+			{
+				std::fprintf(stderr, "%s: lost key #%u\n", name, i);
+
+				return false;
+			}
+		}
+		std::printf("%s: ok\n", name);
+
+		return true;
+	}
+
+	inline /*Ი︵𐑼*/ auto longest_match() -> bool
+	{
+		const tst<uint32_t> tree {std::vector<std::pair<utf32, uint32_t>> {std::begin(WORDS), std::end(WORDS)}};
+
+		const auto snap {tree.freeze()};
+
+		for (const auto& [text, bound, want] : MUNCHES)
+		{
+			if (tree.longest_match(text, text + bound) != want || snap.longest_match(text, text + bound) != want)
+			{
+				std::fprintf(stderr, "longest_match: wrong for \"%.*s\"\n", static_cast<int>(bound), utf8 {utf32 {text}}.c_str());
+
+				return false;
+			}
+		}
+		std::printf("longest_match: ok\n");
+
+		return true;
+	}
+
+	inline /*Ი︵𐑼*/ auto distance(const std::u32string& lhs, const std::u32string& rhs) -> size_t
+	{
+		std::vector<size_t> row(rhs.size() + 1);
+
+		for (size_t j {0}; j <= rhs.size(); ++j)
+		{
+			row[j] = j;
+		}
+		for (size_t i {1}; i <= lhs.size(); ++i)
+		{
+			auto diag {row[0]};
+
+			row[0] = i;
+
+			for (size_t j {1}; j <= rhs.size(); ++j)
+			{
+				const auto next {std::min({row[j] + 1, row[j - 1] + 1, diag + (lhs[i - 1] != rhs[j - 1])})};
+
+				diag = row[j];
+				row[j] = next;
+			}
+		}
+		return row[rhs.size()];
+	}
+
+	inline /*Ი︵𐑼*/ auto near() -> bool
+	{
+		const tst<uint32_t> tree {std::vector<std::pair<utf32, uint32_t>> {std::begin(WORDS), std::end(WORDS)}};
+
+		std::mt19937_64 rng {0x6D6F65};
+
+		for (uint32_t i {0}; i < QUERIES; ++i)
+		{
+			// up to 4 of 'a', 'b', 'c', 'd', 'x' & 'z'
+			std::u32string query;
+
+			for (auto n {rng() % 5}; n; --n)
+			{
+				query += U"abcdxz"[rng() % 6];
+			}
+
+			for (const size_t edits : {0, 1, 2})
+			{
+				const auto got {tree.near(utf32 {query.c_str()}, edits)};
+
+				// (cost, value)
+				std::vector<std::pair<size_t, uint32_t>> lhs;
+				std::vector<std::pair<size_t, uint32_t>> rhs;
+
+				for (const auto& [word, data] : got)
+				{
+					lhs.emplace_back(distance(std::u32string {word.c_str(), word.size()}, query), data);
+				}
+				for (const auto& [word, data] : WORDS)
+				{
+					if (const auto cost {distance(word, query)}; cost <= edits)
+					{
+						rhs.emplace_back(cost, data);
+					}
+				}
+				// nearest first
+				const auto sorted {std::ranges::is_sorted(lhs, {}, [](const auto& it) { return it.first; })};
+
+				std::ranges::sort(lhs);
+				std::ranges::sort(rhs);
+
+				if (!sorted || lhs != rhs)
+				{
+					std::fprintf(stderr, "near: wrong for \"%s\" within %zu\n", utf8 {utf32 {query.c_str()}}.c_str(), edits);
+
+					return false;
+				}
+			}
+		}
+		std::printf("near: ok\n");
+
+		return true;
+	}
+}
+
+auto main() -> int
+{
+	bool fine {true};
+
+	fine &= check("sorted", 1, false);
+	fine &= check("reverse", 1, true);
+	// below a shared prefix
+	fine &= check("sorted, nested", 3, false);
+	fine &= check("reverse, nested", 3, true);
+
+	fine &= longest_match();
+	fine &= near();
+
+	return fine ? 0 : 1;
+}
@@ -0,0 +1,410 @@
+#pragma once
+
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "models/str.hpp"
+
+#include "lang/common/token.hpp"
+
+//|------------------------------------------|
+//| synthetic .moe sources of any size.      |
+//|                                          |
+//| tokens are drawn from a weighted mix;    |
+//| keywords & operators come straight from  |
+//| the X-macros in token.hpp, so the corpus |
+//| follows the language as it grows.        |
+//|------------------------------------------|
+
+namespace corpus
+{
+	enum kind : uint8_t
+	{
+		IDENT,
+		WORD,
+		MARK,
+		NUMBER,
+		STRING,
+		COMMENT,
+		UNICODE,
+	};
+
+	inline constexpr const size_t KINDS {UNICODE + 1};
+
+	// relative weights, by kind
+	typedef std::array<uint32_t, KINDS> mix;
+
+	inline constexpr const mix DEFAULT
+	{
+		30, // IDENT
+		12, // WORD
+		30, // MARK
+		10, // NUMBER
+		 6, // STRING
+		 6, // COMMENT
+		 6, // UNICODE
+	};
+
+	inline constexpr const char* NAMES[]
+	{
+		"ident",
+		"keyword",
+		"operator",
+		"number",
+		"string",
+		"comment",
+		"unicode",
+	};
+
+	namespace // private
+	{
+		// every fixed spelling; words start with a letter or '@'
+		inline /*Ი︵𐑼*/ auto spellings(const bool word) -> std::vector<std::u32string>
+		{
+			std::vector<std::u32string> out;
+
+			const auto add {[&](const char8_t* str)
+			{
+				if (str == nullptr)
+				{
+					return; // literals
+				}
+				const auto head {str[0]};
+
+				const auto is_word
+				{
+					head == '@'
+					||
+					('a' <= head && head <= 'z')
+					||
+					('A' <= head && head <= 'Z')
+				};
+
+				if (is_word == word)
+				{
+					out.emplace_back(str, str + std::char_traits<char8_t>::length(str));
+				}
+			}};
+
+			#define macro(K, V) add(V);
+
+			delimeters(macro)
+			operators(macro)
+			keywords(macro)
+			special(macro)
+			#undef macro
+
+			return out;
+		}
+
+		inline constexpr const char32_t* UNICODE_IDENTS[]
+		{
+			U"café",
+			U"変数",
+			U"переменная",
+			U"μεταβλητή",
+			U"변수",
+			U"𝑥𝑦𝑧",
+		};
+
+		inline constexpr const char32_t* UNICODE_TEXTS[]
+		{
+			U"✓",
+			U"λ → μ",
+			U"日本語",
+			U"😀",
+		};
+	}
+
+	class generator
+	{
+		std::mt19937_64 rng;
+
+		mix weights;
+
+		std::vector<std::u32string> words {spellings(true)};
+		std::vector<std::u32string> marks {spellings(false)};
+
+		template
+		<
+			typename T
+		>
+		inline auto pick(const T& list) -> const auto&
+		{
+			return list[this->rng() % std::size(list)];
+		}
+
+		inline auto ident(std::u32string& out)
+		{
+			static constexpr const char32_t HEAD[] {U"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+			static constexpr const char32_t BODY[] {U"abcdefghijklmnopqrstuvwxyz_0123456789"};
+
+			out += HEAD[this->rng() % (std::size(HEAD) - 1)];
+
+			for (auto i {this->rng() % 12}; i; --i)
+			{
+				out += BODY[this->rng() % (std::size(BODY) - 1)];
+			}
+			// never a keyword by accident
+			out += U'_';
+		}
+
+		inline auto number(std::u32string& out)
+		{
+			const auto value {this->rng() % 100000};
+
+			const auto digits {[&](const uint64_t value, const int radix)
+			{
+				std::string str;
+
+				for (auto n {value}; str.empty() || n; n /= radix)
+				{
+					str += "0123456789ABCDEF"[n % radix];
+				}
+				out.append(str.rbegin(), str.rend());
+			}};
+
+			switch (this->rng() % 5)
+			{
+				case 0: out += U"0b"; digits(value, 2); break;
+				case 1: out += U"0o"; digits(value, 8); break;
+				case 2: out += U"0x"; digits(value, 16); break;
+				case 3: digits(value, 10); out += U'.'; digits(this->rng() % 1000, 10); break;
+				default: digits(value, 10); break;
+			}
+		}
+
+		inline auto string(std::u32string& out)
+		{
+			if (this->rng() % 4 == 0)
+			{
+				out += U'\'';
+				out += this->rng() % 2 ? U"x" : U"\\n";
+				out += U'\'';
+				return;
+			}
+
+			out += U'"';
+
+			for (auto i {this->rng() % 6}; i; --i)
+			{
+				switch (this->rng() % 4)
+				{
+					case 0: out += U"\\\""; break;
+					case 1: out += this->pick(UNICODE_TEXTS); break;
+					default: this->ident(out); break;
+				}
+				out += U' ';
+			}
+			out += U'"';
+		}
+
+		inline auto comment(std::u32string& out)
+		{
+			const auto block {this->rng() % 3 == 0};
+
+			out += block ? U"/*" : U"//";
+
+			for (auto i {this->rng() % 10}; i; --i)
+			{
+				out += U' ';
+
+				if (this->rng() % 4 == 0)
+				{
+					out += this->pick(UNICODE_TEXTS);
+				}
+				else
+				{
+					this->ident(out);
+				}
+				if (block && this->rng() % 4 == 0)
+				{
+					out += U'\n';
+				}
+			}
+			out += block ? U" */" : U"\n";
+		}
+
+	public:
+
+		generator(const mix& weights = DEFAULT, const uint64_t seed = 0x6D6F65)
+		:
+		rng {seed}, weights {weights} {}
+
+		//|-----------------|
+		//| member function |
+		//|-----------------|
+
+		// at least `size` code points of source
+		inline auto make(const size_t size) -> std::u32string
+		{
+			std::u32string out;
+
+			out.reserve(size + 256);
+
+			std::discrete_distribution<size_t> dist
+			{
+				this->weights.begin(),
+				this->weights.end()
+			};
+
+			while (out.size() < size)
+			{
+				switch (dist(this->rng))
+				{
+					case IDENT:
+					{
+						this->ident(out);
+						break;
+					}
+					case WORD:
+					{
+						out += this->pick(this->words);
+						break;
+					}
+					case MARK:
+					{
+						out += this->pick(this->marks);
+						break;
+					}
+					case NUMBER:
+					{
+						this->number(out);
+						break;
+					}
+					case STRING:
+					{
+						this->string(out);
+						break;
+					}
+					case COMMENT:
+					{
+						this->comment(out);
+						break;
+					}
+					case UNICODE:
+					{
+						out += this->pick(UNICODE_IDENTS);
+						break;
+					}
+				}
+				// separator
+				switch (this->rng() % 8)
+				{
+					case 0: out += U'\n'; break;
+					case 1: out += U'\t'; break;
+					default: out += U' '; break;
+				}
+			}
+			return out;
+		}
+
+		//|------------------------------------------|
+		//| parsable functions of `let` decls, one   |
+		//| per line; `rate` of the lines carry one  |
+		//| syntax error each, for error recovery.   |
+		//|------------------------------------------|
+
+		inline auto lines(const size_t size, const double rate) -> std::u32string
+		{
+			static constexpr const char32_t* TYPES[] {U"i32", U"i64", U"f32", U"f64", U"bool"};
+
+			std::u32string out;
+
+			out.reserve(size + 256);
+
+			std::bernoulli_distribution fail {rate};
+
+			while (out.size() < size)
+			{
+				out += U"fun! ";
+				this->ident(out);
+				out += U"(): i32\n{\n";
+
+				for (auto i {8 + this->rng() % 24}; i; --i)
+				{
+					const auto broken {fail(this->rng)};
+					// which part to break
+					const auto where {broken ? 1 + this->rng() % 4 : 0};
+
+					out += U"\tlet ";
+					if (where != 1)
+					{
+						this->ident(out);
+					}
+					if (where != 2)
+					{
+						out += U':';
+					}
+					out += U' ';
+					out += this->pick(TYPES);
+					out += U" = ";
+					this->ident(out);
+					out += U" * (";
+					this->number(out);
+					out += U" + ";
+					if (where != 3)
+					{
+						this->ident(out);
+					}
+					out += U')';
+					if (where != 4)
+					{
+						out += U';';
+					}
+					out += U'\n';
+				}
+				out += U"}\n\n";
+			}
+			return out;
+		}
+
+		template
+		<
+			typename T
+		>
+		// as text<T>
+		static inline auto encode(const std::u32string& src) -> text<T>
+		{
+			text<char32_t> tmp;
+			// allocate
+			tmp.capacity
+			(
+				src.size()
+				+
+				1 /* terminate */
+			);
+			std::ranges::copy(src, tmp.c_str());
+			// update size
+			tmp.size(src.size());
+
+			if constexpr (std::is_same_v<T, char8_t>)
+			{
+				return tmp.to_utf8();
+			}
+			if constexpr (std::is_same_v<T, char16_t>)
+			{
+				return tmp.to_utf16();
+			}
+			if constexpr (std::is_same_v<T, char32_t>)
+			{
+				return tmp;
+			}
+		}
+
+		template
+		<
+			typename T
+		>
+		// encoded as text<T>
+		inline auto make(const size_t size) -> text<T>
+		{
+			return generator::encode<T>(this->make(size));
+		}
+	};
+}